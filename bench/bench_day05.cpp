@@ -0,0 +1,33 @@
+// 2025 Day 5: sorting and merging fresh-ingredient ID ranges
+
+#include <random>
+#include <vector>
+#include "benchmark.hpp"
+#include "2025/day05/solution.hpp"
+
+namespace {
+
+// `count` ranges of up to 1e9 IDs spread over 1e13, so about half overlap
+std::vector<aoc::y2025::Interval> random_intervals(size_t count) {
+    std::mt19937_64 rng(2025);
+    std::uniform_int_distribution<uint64_t> start(1, 10'000'000'000'000ULL);
+    std::uniform_int_distribution<uint64_t> length(0, 1'000'000'000ULL);
+    std::vector<aoc::y2025::Interval> ranges(count);
+    for (auto& [first, last] : ranges) {
+        first = start(rng);
+        last = first + length(rng);
+    }
+    return ranges;
+}
+
+void BM_2025_05_merge_intervals(bench::State& state) {
+    const auto ranges = random_intervals(state.range());
+    for (auto _ : state) {
+        auto merged = aoc::y2025::merge_intervals(ranges);
+        bench::do_not_optimize(merged.data());
+    }
+    state.set_items_processed(state.iterations() * state.range());
+}
+AOC_BENCHMARK(BM_2025_05_merge_intervals)->arg(1 << 8)->arg(1 << 12)->arg(1 << 16);
+
+} // namespace
@@ -0,0 +1,45 @@
+// 2025 Day 8: k-d tree construction and k-nearest-neighbour queries
+
+#include <random>
+#include <vector>
+#include "benchmark.hpp"
+#include "2025/day08/kdtree.hpp"
+
+namespace {
+
+using aoc::y2025::Point;
+
+// Uniform points in a 100000^3 cube, like scripts/generate_input.py
+std::vector<Point> random_points(size_t count) {
+    std::mt19937_64 rng(2025);
+    std::uniform_int_distribution<int> coord(0, 99999);
+    std::vector<Point> points(count);
+    for (auto& p : points) p = {coord(rng), coord(rng), coord(rng)};
+    return points;
+}
+
+void BM_2025_08_kdtree_build(bench::State& state) {
+    const auto points = random_points(state.range());
+    for (auto _ : state) {
+        aoc::y2025::KDTree tree(points);
+        bench::do_not_optimize(tree.size());
+    }
+    state.set_items_processed(state.iterations() * state.range());
+}
+AOC_BENCHMARK(BM_2025_08_kdtree_build)->arg(1 << 10)->arg(1 << 14)->arg(1 << 17);
+
+void BM_2025_08_knn_all(bench::State& state) {
+    constexpr int K = 7;
+    const auto points = random_points(state.range());
+    const aoc::y2025::KDTree tree(points);
+    std::vector<aoc::y2025::Neighbor> out(points.size() * K);
+    std::vector<int> counts(points.size());
+    for (auto _ : state) {
+        tree.knn_all(points, K, out.data(), counts.data());
+        bench::do_not_optimize(out.data());
+    }
+    state.set_items_processed(state.iterations() * state.range());
+}
+AOC_BENCHMARK(BM_2025_08_knn_all)->arg(1 << 10)->arg(1 << 14)->arg(1 << 17);
+
+} // namespace
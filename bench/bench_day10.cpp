@@ -0,0 +1,74 @@
+// 2025 Day 10: GF(2) and integer elimination of machine wiring
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "benchmark.hpp"
+#include "2025/day10/factorization.hpp"
+
+namespace {
+
+using aoc::y2025::Machine;
+
+// A machine with `counters` lights/counters and counters + 2 buttons, each
+// wired to a random non-empty proper subset
+Machine random_machine(size_t counters, std::mt19937_64& rng) {
+    Machine m;
+    m.light_target.resize(counters);
+    m.joltage_target.resize(counters);
+    std::vector<uint16_t> all(counters);
+    std::iota(all.begin(), all.end(), 0);
+    for (size_t b = 0; b < counters + 2; b++) {
+        std::shuffle(all.begin(), all.end(), rng);
+        size_t wires = 1 + rng() % (counters - 1);
+        std::vector<uint16_t> button(all.begin(), all.begin() + wires);
+        std::sort(button.begin(), button.end());
+        for (uint16_t c : button) {
+            m.light_target[c] ^= rng() & 1;
+            m.joltage_target[c] += rng() % 31;
+        }
+        m.buttons.push_back(std::move(button));
+    }
+    return m;
+}
+
+std::vector<Machine> random_machines(size_t counters) {
+    std::mt19937_64 rng(2025);
+    std::vector<Machine> machines;
+    for (int i = 0; i < 64; i++) machines.push_back(random_machine(counters, rng));
+    return machines;
+}
+
+std::vector<size_t> identity_order(const Machine& m) {
+    std::vector<size_t> order(m.num_buttons());
+    std::iota(order.begin(), order.end(), 0);
+    return order;
+}
+
+// Argument is the number of counters per machine
+void BM_2025_10_factorize_gf2(bench::State& state) {
+    const auto machines = random_machines(state.range());
+    for (auto _ : state) {
+        for (const Machine& m : machines) {
+            auto f = aoc::y2025::factorize_gf2(m, identity_order(m));
+            bench::do_not_optimize(f.dimension);
+        }
+    }
+    state.set_items_processed(state.iterations() * machines.size());
+}
+AOC_BENCHMARK(BM_2025_10_factorize_gf2)->arg(4)->arg(10)->arg(32)->arg(128);
+
+void BM_2025_10_factorize_integer(bench::State& state) {
+    const auto machines = random_machines(state.range());
+    for (auto _ : state) {
+        for (const Machine& m : machines) {
+            auto f = aoc::y2025::factorize_integer(m, identity_order(m));
+            bench::do_not_optimize(f.rank());
+        }
+    }
+    state.set_items_processed(state.iterations() * machines.size());
+}
+AOC_BENCHMARK(BM_2025_10_factorize_integer)->arg(4)->arg(10);
+
+} // namespace
@@ -0,0 +1,70 @@
+// Scheduling overhead of the common thread pool: an empty task through a
+// TaskGroup, parallel_for at several grain sizes against a plain loop, and
+// parallel_reduce.
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+#include "benchmark.hpp"
+#include "common/thread_pool.hpp"
+
+namespace {
+
+constexpr size_t ELEMENTS = 1 << 22;
+
+uint64_t work(uint64_t x) { return x * 0x9e3779b97f4a7c15ULL >> 7; }
+
+void BM_task_group_empty_tasks(bench::State& state) {
+    aoc::ThreadPool& pool = aoc::ThreadPool::instance();
+    const size_t tasks = state.range();
+    for (auto _ : state) {
+        std::atomic<uint64_t> count{0};
+        aoc::TaskGroup group(pool);
+        for (size_t i = 0; i < tasks; i++) group.run([&count] { count.fetch_add(1, std::memory_order_relaxed); });
+        group.wait();
+        bench::do_not_optimize(count.load());
+    }
+    state.set_items_processed(state.iterations() * tasks);
+}
+AOC_BENCHMARK(BM_task_group_empty_tasks)->arg(100000);
+
+void BM_serial_loop(bench::State& state) {
+    std::vector<uint64_t> data(ELEMENTS);
+    std::iota(data.begin(), data.end(), 0);
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < ELEMENTS; i++) sum += work(data[i]);
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * ELEMENTS);
+}
+AOC_BENCHMARK(BM_serial_loop);
+
+// Argument is the grain; 0 is the automatic choice
+void BM_parallel_for(bench::State& state) {
+    std::vector<uint64_t> data(ELEMENTS), out(ELEMENTS);
+    std::iota(data.begin(), data.end(), 0);
+    for (auto _ : state) {
+        aoc::parallel_for(ELEMENTS, [&](size_t i) { out[i] = work(data[i]); }, state.range());
+        bench::do_not_optimize(out.data());
+    }
+    state.set_items_processed(state.iterations() * ELEMENTS);
+}
+AOC_BENCHMARK(BM_parallel_for)->arg(256)->arg(4096)->arg(65536)->arg(0);
+
+void BM_parallel_reduce(bench::State& state) {
+    std::vector<uint64_t> data(ELEMENTS);
+    std::iota(data.begin(), data.end(), 0);
+    for (auto _ : state) {
+        uint64_t sum = aoc::parallel_reduce(ELEMENTS, 0, uint64_t(0), [&](size_t begin, size_t end) {
+            uint64_t partial = 0;
+            for (size_t i = begin; i < end; i++) partial += work(data[i]);
+            return partial;
+        }, [](uint64_t a, uint64_t b) { return a + b; });
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * ELEMENTS);
+}
+AOC_BENCHMARK(BM_parallel_reduce);
+
+} // namespace
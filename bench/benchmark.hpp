@@ -0,0 +1,105 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "common/answer.hpp"
+
+// Minimal micro-benchmark registry for solution kernels, in the style of
+// Google Benchmark:
+//
+//   void BM_merge(bench::State& state) {
+//       auto data = make_data(state.range());   // setup, not timed
+//       for (auto _ : state) bench::do_not_optimize(merge(data));
+//       state.set_items_processed(state.iterations() * state.range());
+//   }
+//   AOC_BENCHMARK(BM_merge)->arg(1 << 10)->arg(1 << 16);
+//
+// The driver (bench/main.cpp) picks the iteration count per argument.
+
+namespace bench {
+
+class State {
+public:
+    State(int64_t range, uint64_t iterations) : range_(range), iterations_(iterations) {}
+
+    int64_t range() const { return range_; }
+    uint64_t iterations() const { return iterations_; }
+
+    void set_items_processed(uint64_t items) { items_ = items; }
+    uint64_t items_processed() const { return items_; }
+
+    double seconds() const { return seconds_; }
+
+    // The timed loop: the clock starts at begin() and stops when the loop
+    // has run iterations() times
+    struct Iterator {
+        State* state;
+        uint64_t remaining;
+
+        // Empty tag marked [[maybe_unused]], so `for (auto _ : state)`
+        // doesn't warn about the unused loop variable
+        struct [[maybe_unused]] Value {};
+        Value operator*() const { return {}; }
+        Iterator& operator++() {
+            --remaining;
+            return *this;
+        }
+        bool operator!=(const Iterator&) const {
+            if (remaining != 0) return true;
+            state->stop();
+            return false;
+        }
+    };
+
+    Iterator begin() {
+        start_ = std::chrono::steady_clock::now();
+        return {this, iterations_};
+    }
+    Iterator end() { return {this, 0}; }
+
+private:
+    int64_t range_;
+    uint64_t iterations_;
+    uint64_t items_ = 0;
+    double seconds_ = 0;
+    std::chrono::steady_clock::time_point start_;
+
+    void stop() {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+        seconds_ = elapsed.count();
+    }
+};
+
+using aoc::do_not_optimize;
+
+struct Benchmark {
+    std::string name;
+    std::function<void(State&)> fn;
+    std::vector<int64_t> args;
+
+    Benchmark* arg(int64_t value) {
+        args.push_back(value);
+        return this;
+    }
+};
+
+inline std::vector<Benchmark*>& registry() {
+    static std::vector<Benchmark*> benchmarks;
+    return benchmarks;
+}
+
+inline Benchmark* register_benchmark(const char* name, std::function<void(State&)> fn) {
+    registry().push_back(new Benchmark{name, std::move(fn), {}});
+    return registry().back();
+}
+
+} // namespace bench
+
+#define AOC_BENCH_CONCAT_(a, b) a##b
+#define AOC_BENCH_CONCAT(a, b) AOC_BENCH_CONCAT_(a, b)
+#define AOC_BENCHMARK(fn)                                                              \
+    static ::bench::Benchmark* AOC_BENCH_CONCAT(aoc_benchmark_, __LINE__) [[maybe_unused]] = \
+        ::bench::register_benchmark(#fn, fn)
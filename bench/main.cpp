@@ -0,0 +1,78 @@
+// Micro-benchmarks for the solution kernels.
+//
+//   aoc_bench [--filter=<substring>] [--threads=N] [--min-time=<seconds>]
+//
+// Every registered benchmark runs once per argument. The iteration count
+// grows until one timed run takes at least --min-time (default 0.1 s);
+// that run is reported.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "benchmark.hpp"
+#include "common/thread_pool.hpp"
+
+namespace {
+
+void print_time(double ns) {
+    if (ns >= 1e6) std::printf("%12.3f ms", ns / 1e6);
+    else if (ns >= 1e3) std::printf("%12.3f us", ns / 1e3);
+    else std::printf("%12.1f ns", ns);
+}
+
+void run(const bench::Benchmark& benchmark, int64_t arg, double min_time) {
+    uint64_t iterations = 1;
+    while (true) {
+        bench::State state(arg, iterations);
+        benchmark.fn(state);
+        const double seconds = state.seconds();
+        if (seconds >= min_time || iterations >= (uint64_t(1) << 40)) {
+            std::string label = benchmark.name;
+            if (!benchmark.args.empty()) label += "/" + std::to_string(arg);
+            std::printf("%-40s", label.c_str());
+            print_time(seconds * 1e9 / iterations);
+            std::printf(" %12llu iter", (unsigned long long)iterations);
+            if (state.items_processed() > 0) {
+                std::printf(" %10.2f M items/s", state.items_processed() / seconds / 1e6);
+            }
+            std::printf("\n");
+            return;
+        }
+        // Aim past the target so the next run is usually the last
+        const double scale = seconds > 0 ? min_time * 1.4 / seconds : 10;
+        iterations = std::max(iterations + 1, uint64_t(iterations * std::min(scale, 10.0)));
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string filter;
+    double min_time = 0.1;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.rfind("--filter=", 0) == 0) {
+            filter = arg.substr(9);
+        } else if (arg.rfind("--threads=", 0) == 0) {
+            aoc::ThreadPool::set_default_concurrency(std::atoi(arg.c_str() + 10));
+        } else if (arg.rfind("--min-time=", 0) == 0) {
+            min_time = std::atof(arg.c_str() + 11);
+        } else {
+            std::fprintf(stderr, "Usage: %s [--filter=<substring>] [--threads=N] [--min-time=<seconds>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::printf("%u threads\n\n", aoc::ThreadPool::instance().concurrency());
+    for (const bench::Benchmark* benchmark : bench::registry()) {
+        if (!filter.empty() && benchmark->name.find(filter) == std::string::npos) continue;
+        if (benchmark->args.empty()) {
+            run(*benchmark, 0, min_time);
+        } else {
+            for (int64_t arg : benchmark->args) run(*benchmark, arg, min_time);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""Build the optimization profiles side by side and compare per-day timings.
+
+Every profile gets its own build directory under build-compare/. The PGO
+profile is built twice in the same directory: once instrumented, trained
+with `aoc --all --bench` (and the examples), then rebuilt with the profile.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+from pathlib import Path
+
+from benchmark_all import PROJECT_ROOT, find_solutions, format_time, run_benchmark
+
+COMPARE_DIR = PROJECT_ROOT / "build-compare"
+
+# name -> CMake options (PGO stages are added separately)
+PROFILES = {
+    "baseline": [],
+    "lto": ["-DAOC_LTO=ON"],
+    "native": ["-DAOC_NATIVE=ON"],
+    "pgo": [],
+    "lto+native+pgo": ["-DAOC_LTO=ON", "-DAOC_NATIVE=ON"],
+}
+PGO_PROFILES = {"pgo", "lto+native+pgo"}
+
+
+def cmake_build(build_dir: Path, options: list) -> None:
+    build_dir.mkdir(parents=True, exist_ok=True)
+    subprocess.run(["cmake", "-S", str(PROJECT_ROOT), "-B", str(build_dir),
+                    "-DCMAKE_BUILD_TYPE=Release", *options],
+                   check=True, stdout=subprocess.DEVNULL)
+    subprocess.run(["cmake", "--build", str(build_dir), "--target", "aoc",
+                    "-j", str(os.cpu_count() or 4)],
+                   check=True, stdout=subprocess.DEVNULL)
+
+
+def build_profile(name: str) -> Path:
+    build_dir = COMPARE_DIR / name.replace("+", "_")
+    options = PROFILES[name]
+    if name in PGO_PROFILES:
+        profile_dir = build_dir / "pgo-profile"
+        subprocess.run(["rm", "-rf", str(profile_dir)], check=True)
+        cmake_build(build_dir, options + ["-DAOC_PGO=generate", f"-DAOC_PGO_DIR={profile_dir}"])
+        aoc = build_dir / "aoc"
+        for extra in ([], ["--example"]):
+            subprocess.run([str(aoc), "--all", "--bench", *extra],
+                           stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        options = options + ["-DAOC_PGO=use", f"-DAOC_PGO_DIR={profile_dir}"]
+    else:
+        options = options + ["-DAOC_PGO="]
+    cmake_build(build_dir, options)
+    return build_dir / "aoc"
+
+
+def total_us(result: dict):
+    if "error" in result:
+        return None
+    return sum(part.get("time_us", 0) for part in result.values())
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare build profiles per day")
+    parser.add_argument("--profiles", "-p", default=",".join(PROFILES),
+                        help=f"Comma-separated profiles (default: {','.join(PROFILES)})")
+    parser.add_argument("--year", "-y", type=int, help="Filter by year")
+    parser.add_argument("--skip-build", action="store_true", help="Reuse existing builds")
+    args = parser.parse_args()
+
+    profiles = [p for p in args.profiles.split(",") if p]
+    unknown = [p for p in profiles if p not in PROFILES]
+    if unknown:
+        print(f"Unknown profile(s): {', '.join(unknown)}")
+        return 1
+    if "baseline" not in profiles:
+        profiles.insert(0, "baseline")
+
+    binaries = {}
+    for name in profiles:
+        if args.skip_build:
+            binaries[name] = COMPARE_DIR / name.replace("+", "_") / "aoc"
+        else:
+            print(f"Building {name}...", flush=True)
+            binaries[name] = build_profile(name)
+
+    solutions = find_solutions()
+    if args.year:
+        solutions = [(y, d) for y, d in solutions if y == args.year]
+
+    rows = []
+    for year, day in solutions:
+        print(f"Running {year} Day {day:02d}...", flush=True, file=sys.stderr)
+        rows.append((year, day, {name: total_us(run_benchmark(year, day, binaries[name]))
+                                 for name in profiles}))
+
+    print("\n| Year | Day | " + " | ".join(profiles) + " |")
+    print("|------|-----|" + "|".join("-" * (len(p) + 2) for p in profiles) + "|")
+    for year, day, times in rows:
+        base = times["baseline"]
+        cells = []
+        for name in profiles:
+            t = times[name]
+            if t is None:
+                cells.append("error")
+            elif name == "baseline" or not base or not t:
+                cells.append(format_time(t))
+            else:
+                cells.append(f"{format_time(t)} ({base / t:.2f}x)")
+        print(f"| {year} | {day:02d} | " + " | ".join(cells) + " |")
+    return 0
+
+
+if __name__ == "__main__":
+    exit(main())
@@ -26,19 +26,29 @@ def find_solutions():
     return solutions
 
 
-def run_benchmark(year: int, day: int) -> dict:
-    """Run benchmark for a single day."""
+# Only if aoc's own watchdog (--timeout) fails to stop a day
+BACKSTOP_SECONDS = 1800
+
+
+def run_benchmark(year: int, day: int, aoc_bin: Path = AOC_BIN, timeout: float = 10,
+                  cache: bool = False, force: bool = False) -> dict:
+    """Run benchmark for a single day. Parts over `timeout` seconds per call
+    are stopped by aoc and reported with "timed_out". With `cache`, aoc
+    reports the cached timings of a build and input it has already
+    benchmarked instead of running again, unless `force` is set."""
+    command = [str(aoc_bin), str(year), str(day), "--bench", f"--timeout={timeout:g}"]
+    if cache:
+        command.append("--cache")
+    if force:
+        command.append("--force")
     try:
         result = subprocess.run(
-            [str(AOC_BIN), str(year), str(day), "--bench"],
+            command,
             capture_output=True,
             text=True,
-            timeout=60
+            timeout=BACKSTOP_SECONDS
         )
         
-        if result.returncode != 0:
-            return {"error": result.stderr.strip() or "Unknown error"}
-        
         output = result.stdout
         times = {}
         
@@ -49,11 +59,17 @@ def run_benchmark(year: int, day: int) -> dict:
                 "answer": match.group(2),
                 "time_us": int(match.group(3))
             }
+        # and "Part 2: timed out after 10.0 s, progress 27/200 (13.5%)"
+        for match in re.finditer(r"Part (\d): (timed out after .+)", output):
+            times[f"part{match.group(1)}"] = {"timed_out": match.group(2)}
         
+        # 124: a part timed out; the other part's results still count
+        if result.returncode not in (0, 124) or not times:
+            return {"error": result.stderr.strip() or "Unknown error"}
         return times
         
     except subprocess.TimeoutExpired:
-        return {"error": "Timeout (>60s)"}
+        return {"error": f"Timeout (>{BACKSTOP_SECONDS}s)"}
     except Exception as e:
         return {"error": str(e)}
 
@@ -68,15 +84,26 @@ def format_time(us: int) -> str:
         return f"{us/1000000:.2f} s"
 
 
+def format_part(result: dict, part: str) -> str:
+    """Time of one part, or "timed out"."""
+    timing = result.get(part, {})
+    return "timed out" if "timed_out" in timing else format_time(timing.get("time_us", 0))
+
+
 def main():
     parser = argparse.ArgumentParser(description="Benchmark all AoC solutions")
     parser.add_argument("--markdown", "-m", action="store_true", help="Output as Markdown table")
     parser.add_argument("--year", "-y", type=int, help="Filter by year")
+    parser.add_argument("--bin", type=Path, default=AOC_BIN, help="aoc binary to benchmark (default: build/aoc)")
+    parser.add_argument("--timeout", type=float, default=10,
+                        help="Stop a part call after this many seconds (default: 10)")
+    parser.add_argument("--force", "-f", action="store_true",
+                        help="Benchmark every day again instead of reusing cached timings")
     
     args = parser.parse_args()
     
-    if not AOC_BIN.exists():
-        print(f"❌ Build not found. Run: make build")
+    if not args.bin.exists():
+        print(f"❌ Build not found: {args.bin}. Run: make build")
         return 1
     
     solutions = find_solutions()
@@ -90,14 +117,14 @@ def main():
     results = []
     for year, day in solutions:
         print(f"Running {year} Day {day:02d}...", end=" ", flush=True)
-        result = run_benchmark(year, day)
+        result = run_benchmark(year, day, args.bin, args.timeout, cache=True, force=args.force)
         results.append((year, day, result))
         
         if "error" in result:
             print(f"❌ {result['error']}")
         else:
-            p1 = format_time(result.get("part1", {}).get("time_us", 0))
-            p2 = format_time(result.get("part2", {}).get("time_us", 0))
+            p1 = format_part(result, "part1")
+            p2 = format_part(result, "part2")
             print(f"✓ Part 1: {p1}, Part 2: {p2}")
     
     if args.markdown:
@@ -111,7 +138,9 @@ def main():
             else:
                 p1_us = result.get("part1", {}).get("time_us", 0)
                 p2_us = result.get("part2", {}).get("time_us", 0)
-                print(f"| {year} | {day:02d} | {format_time(p1_us)} | {format_time(p2_us)} | {format_time(p1_us + p2_us)} |")
+                timed_out = any("timed_out" in result.get(part, {}) for part in ("part1", "part2"))
+                total = "-" if timed_out else format_time(p1_us + p2_us)
+                print(f"| {year} | {day:02d} | {format_part(result, 'part1')} | {format_part(result, 'part2')} | {total} |")
     
     return 0
 
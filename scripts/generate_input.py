@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""Generate large synthetic inputs for stress-testing and benchmarking."""
+
+import argparse
+import random
+from pathlib import Path
+
+SCRIPT_DIR = Path(__file__).parent
+PROJECT_ROOT = SCRIPT_DIR.parent
+
+
+def gen_2025_07(size: int, rng: random.Random) -> str:
+    """Tachyon manifold: `size` splitter rows, dense enough that the
+    number of timelines grows exponentially with depth."""
+    width = 2 * size + 3
+    rows = ["." * width]
+    start = width // 2
+    rows[0] = rows[0][:start] + "S" + rows[0][start + 1:]
+    for depth in range(size):
+        row = ["."] * width
+        for x in range(start - depth, start + depth + 1, 2):
+            if 0 < x < width - 1 and rng.random() < 0.9:
+                row[x] = "^"
+        rows.append("".join(row))
+        rows.append("." * width)
+    return "\n".join(rows) + "\n"
+
+
+def gen_2025_08(size: int, rng: random.Random) -> str:
+    """Junction boxes: `size` random points in a 100000^3 cube."""
+    lines = []
+    for _ in range(size):
+        lines.append(",".join(str(rng.randrange(100000)) for _ in range(3)))
+    return "\n".join(lines) + "\n"
+
+
+def gen_2025_09(size: int, rng: random.Random) -> str:
+    """Red tiles: a rectilinear "skyline" polygon with about `size` corners,
+    listed in order so consecutive tiles share a row or column."""
+    columns = max(2, size // 2 - 1)
+    xs = [1]
+    for _ in range(columns):
+        xs.append(xs[-1] + rng.randint(1, 500))
+    heights = []
+    for _ in range(columns):
+        h = rng.randint(2, 100000)
+        while heights and h == heights[-1]:
+            h = rng.randint(2, 100000)
+        heights.append(h)
+    base = 1
+    corners = [(xs[0], base), (xs[-1], base)]
+    for k in range(columns - 1, -1, -1):
+        corners.append((xs[k + 1], heights[k]))
+        corners.append((xs[k], heights[k]))
+    return "\n".join(f"{x},{y}" for x, y in corners) + "\n"
+
+
+def gen_2025_10(size: int, rng: random.Random) -> str:
+    """Factory machines: `size` machines, each built from a random press
+    vector so both the light pattern and the joltage targets are reachable.
+    Wiring layouts come from a pool of about size/4, so layouts repeat."""
+    layouts = []
+    for _ in range(max(1, size // 4)):
+        counters = rng.randint(4, 10)
+        buttons = []
+        for _ in range(rng.randint(counters - 2, counters + 3)):
+            wires = sorted(rng.sample(range(counters), rng.randint(1, counters - 1)))
+            buttons.append(wires)
+        layouts.append((counters, buttons))
+
+    lines = []
+    for _ in range(size):
+        counters, buttons = rng.choice(layouts)
+        lights = [0] * counters
+        for wires in buttons:
+            if rng.random() < 0.5:
+                for c in wires:
+                    lights[c] ^= 1
+        joltage = [0] * counters
+        for wires in buttons:
+            presses = rng.randint(0, 30)
+            for c in wires:
+                joltage[c] += presses
+        pattern = "".join("#" if on else "." for on in lights)
+        wiring = " ".join("(" + ",".join(map(str, w)) + ")" for w in buttons)
+        lines.append(f"[{pattern}] {wiring} {{{','.join(map(str, joltage))}}}")
+    return "\n".join(lines) + "\n"
+
+
+GENERATORS = {
+    (2025, 7): gen_2025_07,
+    (2025, 8): gen_2025_08,
+    (2025, 9): gen_2025_09,
+    (2025, 10): gen_2025_10,
+}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate a synthetic AoC input")
+    parser.add_argument("year", type=int, help="Year (e.g., 2025)")
+    parser.add_argument("day", type=int, help="Day (1-25)")
+    parser.add_argument("--size", "-n", type=int, default=1000, help="Problem size")
+    parser.add_argument("--seed", type=int, default=2025, help="Random seed")
+    parser.add_argument("--output", "-o", type=Path, help="Output file")
+
+    args = parser.parse_args()
+
+    generator = GENERATORS.get((args.year, args.day))
+    if generator is None:
+        print(f"No generator for {args.year} Day {args.day}")
+        return 1
+
+    output = args.output or (PROJECT_ROOT / "data" / str(args.year)
+                             / f"day{args.day:02d}" / f"generated_{args.size}.txt")
+    output.parent.mkdir(parents=True, exist_ok=True)
+    output.write_text(generator(args.size, random.Random(args.seed)))
+    print(f"✓ Wrote {output}")
+    print(f"   Run: ./build/aoc {args.year} {args.day} --input={output}")
+    return 0
+
+
+if __name__ == "__main__":
+    exit(main())
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""Plot the CSV written by `aoc <year> <day> --scale --csv=<path>` as
+log-log charts of time and peak heap against input size."""
+
+import argparse
+import csv
+from pathlib import Path
+
+
+def load(path: Path) -> dict:
+    """{part: [(n, time_us, peak_bytes), ...]} for the rows without errors."""
+    series = {}
+    with path.open() as f:
+        for row in csv.DictReader(f):
+            if row["error"]:
+                continue
+            series.setdefault(int(row["part"]), []).append(
+                (int(row["n"]), float(row["time_us"]), int(row["peak_heap_bytes"])))
+    return series
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Chart an aoc --scale CSV")
+    parser.add_argument("csv", type=Path, help="CSV from --scale --csv=<path>")
+    parser.add_argument("--output", "-o", type=Path, help="Image file (default: <csv>.png)")
+    args = parser.parse_args()
+
+    try:
+        import matplotlib
+        matplotlib.use("Agg")
+        import matplotlib.pyplot as plt
+    except ImportError:
+        print("❌ matplotlib is required: pip install matplotlib")
+        return 1
+
+    series = load(args.csv)
+    fig, (time_ax, memory_ax) = plt.subplots(1, 2, figsize=(11, 4.5))
+    for part, points in sorted(series.items()):
+        ns = [n for n, _, _ in points]
+        time_ax.loglog(ns, [us for _, us, _ in points], "o-", label=f"part {part}")
+        memory = [(n, peak) for n, _, peak in points if peak > 0]
+        if memory:
+            memory_ax.loglog(*zip(*memory), "o-", label=f"part {part}")
+    time_ax.set(xlabel="n", ylabel="time (µs)", title="Time")
+    memory_ax.set(xlabel="n", ylabel="peak heap (bytes)", title="Memory")
+    for ax in (time_ax, memory_ax):
+        ax.grid(True, which="both", alpha=0.3)
+        ax.legend()
+
+    output = args.output or args.csv.with_suffix(".png")
+    fig.tight_layout()
+    fig.savefig(output)
+    print(f"✓ Wrote {output}")
+    return 0
+
+
+if __name__ == "__main__":
+    exit(main())
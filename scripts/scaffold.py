@@ -18,8 +18,8 @@ namespace aoc::y{year} {{
 
 class Day{day:02d} : public Solution {{
 public:
-    std::string part1(const std::string& input) override;
-    std::string part2(const std::string& input) override;
+    Answer part1(const std::string& input) override;
+    Answer part2(const std::string& input) override;
     
     int year() const override {{ return {year}; }}
     int day() const override {{ return {day}; }}
@@ -29,12 +29,11 @@ public:
 '''
 
 SOLUTION_CPP_TEMPLATE = '''#include "solution.hpp"
-#include "common/registry.hpp"
 #include "common/utils.hpp"
 
 namespace aoc::y{year} {{
 
-std::string Day{day:02d}::part1(const std::string& input) {{
+Answer Day{day:02d}::part1(const std::string& input) {{
     auto lines = split(input);
     
     // TODO: Implement part 1
@@ -42,7 +41,7 @@ std::string Day{day:02d}::part1(const std::string& input) {{
     return "TODO";
 }}
 
-std::string Day{day:02d}::part2(const std::string& input) {{
+Answer Day{day:02d}::part2(const std::string& input) {{
     auto lines = split(input);
     
     // TODO: Implement part 2
@@ -50,8 +49,6 @@ std::string Day{day:02d}::part2(const std::string& input) {{
     return "TODO";
 }}
 
-REGISTER_SOLUTION(Day{day:02d})
-
 }} // namespace aoc::y{year}
 '''
 
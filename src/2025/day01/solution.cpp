@@ -1,10 +1,9 @@
 #include "solution.hpp"
-#include "common/registry.hpp"
 #include "common/utils.hpp"
 
 namespace aoc::y2025 {
 
-std::string Day01::part1(const std::string& input) {
+Answer Day01::part1(const std::string& input) {
     auto lines = split(input);
 
     int zeros = 0;
@@ -25,12 +24,10 @@ std::string Day01::part1(const std::string& input) {
 
     }
 
-    std::string result = std::to_string(zeros);
-    
-    return result;
+    return zeros;
 }
 
-std::string Day01::part2(const std::string& input) {
+Answer Day01::part2(const std::string& input) {
     auto lines = split(input);
 
     int zeros = 0;
@@ -61,11 +58,7 @@ std::string Day01::part2(const std::string& input) {
 
     }
 
-    std::string result = std::to_string(zeros);
-    
-    return result;
+    return zeros;
 }
 
-REGISTER_SOLUTION(Day01)
-
 } // namespace aoc::y2025
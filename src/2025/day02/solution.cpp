@@ -1,5 +1,4 @@
 #include "solution.hpp"
-#include "common/registry.hpp"
 #include "common/utils.hpp"
 #include <map>
 #include <vector>
@@ -113,22 +112,20 @@ uint64_t sum_repeated_patterns(uint64_t lo, uint64_t hi)
 
 } // anonymous namespace
 
-std::string Day02::part1(const std::string& input)
+Answer Day02::part1(const std::string& input)
 {
     uint64_t result = 0;
     for (auto [start, end] : parse_ranges(input))
         result += sum_doubled_patterns(start, end);
-    return std::to_string(result);
+    return result;
 }
 
-std::string Day02::part2(const std::string& input)
+Answer Day02::part2(const std::string& input)
 {
     uint64_t result = 0;
     for (auto [start, end] : parse_ranges(input))
         result += sum_repeated_patterns(start, end);
-    return std::to_string(result);
+    return result;
 }
 
-REGISTER_SOLUTION(Day02)
-
 } // namespace aoc::y2025
\ No newline at end of file
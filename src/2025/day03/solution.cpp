@@ -1,10 +1,9 @@
 #include "solution.hpp"
-#include "common/registry.hpp"
 #include "common/utils.hpp"
 
 namespace aoc::y2025 {
 
-std::string Day03::part1(const std::string& input) {
+Answer Day03::part1(const std::string& input) {
     auto lines = split(input);
     uint64_t result = 0;
 
@@ -25,10 +24,10 @@ std::string Day03::part1(const std::string& input) {
         }
         result += best;
     }
-    return std::to_string(result);
+    return result;
 }
 
-std::string Day03::part2(const std::string& input) {
+Answer Day03::part2(const std::string& input) {
     auto lines = split(input);
     uint64_t result = 0;
 
@@ -54,9 +53,7 @@ std::string Day03::part2(const std::string& input) {
         result += std::stoull(stack);
     }
     
-    return std::to_string(result);
+    return result;
 }
 
-REGISTER_SOLUTION(Day03)
-
 } // namespace aoc::y2025
@@ -1,11 +1,10 @@
 #include "solution.hpp"
-#include "common/registry.hpp"
 #include "common/utils.hpp"
 #include <common/utils.h>
 
 namespace aoc::y2025 {
 
-std::string Day04::part1(const std::string& input) {
+Answer Day04::part1(const std::string& input) {
     std::vector<std::string> lines = split(input);
 
     int accessible_rolls = 0;
@@ -42,10 +41,10 @@ std::string Day04::part1(const std::string& input) {
         }
     }
     
-    return std::to_string(accessible_rolls);
+    return accessible_rolls;
 }
 
-std::string Day04::part2(const std::string& input) {
+Answer Day04::part2(const std::string& input) {
     std::vector<std::string> grid = split(input);
     int rows = grid.size();
     int cols = grid[0].size();
@@ -93,9 +92,7 @@ std::string Day04::part2(const std::string& input) {
         }
     }
     
-    return std::to_string(total_removed);
+    return total_removed;
 }
 
-REGISTER_SOLUTION(Day04)
-
 } // namespace aoc::y2025
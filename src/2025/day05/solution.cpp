@@ -1,13 +1,34 @@
 #include "solution.hpp"
-#include "common/registry.hpp"
 #include "common/utils.hpp"
+#include <algorithm>
 
 namespace aoc::y2025 {
 
-std::string Day05::part1(const std::string& input) {
+std::vector<Interval> merge_intervals(std::vector<Interval> ranges) {
+    // Sort and merge overlapping/adjacent ranges
+    std::sort(ranges.begin(), ranges.end());
+    std::vector<Interval> merged;
+
+    for (const auto& [start, end] : ranges) {
+        if (merged.empty()) {
+            merged.emplace_back(start, end);
+            continue;
+        }
+
+        auto& [m_start, m_end] = merged.back();
+        if (start > m_end + 1) {
+            merged.emplace_back(start, end);
+        } else {
+            m_end = std::max(m_end, end);
+        }
+    }
+    return merged;
+}
+
+Answer Day05::part1(const std::string& input) {
     auto lines = split(input, '\n');
     
-    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    std::vector<Interval> ranges;
     size_t start_ids_idx = 0;
 
     // Parse the ranges
@@ -28,23 +49,7 @@ std::string Day05::part1(const std::string& input) {
         }
     }
 
-    // Sort and merge overlapping/adjacent ranges
-    std::sort(ranges.begin(), ranges.end());
-    std::vector<std::pair<uint64_t, uint64_t>> merged;
-
-    for (const auto& [start, end] : ranges) {
-        if (merged.empty()) {
-            merged.emplace_back(start, end);
-            continue;
-        }
-
-        auto& [m_start, m_end] = merged.back();
-        if (start > m_end + 1) {
-            merged.emplace_back(start, end);
-        } else {
-            m_end = std::max(m_end, end);
-        }
-    }
+    auto merged = merge_intervals(std::move(ranges));
 
     uint64_t result = 0;
     for (size_t i = start_ids_idx; i < lines.size(); ++i) {
@@ -71,13 +76,13 @@ std::string Day05::part1(const std::string& input) {
         }
     }
     
-    return std::to_string(result);
+    return result;
 }
 
-std::string Day05::part2(const std::string& input) {
+Answer Day05::part2(const std::string& input) {
     auto lines = split(input, '\n');
     
-    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    std::vector<Interval> ranges;
     size_t start_ids_idx = 0;
 
     // Parse the ranges
@@ -98,23 +103,7 @@ std::string Day05::part2(const std::string& input) {
         }
     }
 
-    // Sort and merge overlapping/adjacent ranges
-    std::sort(ranges.begin(), ranges.end());
-    std::vector<std::pair<uint64_t, uint64_t>> merged;
-
-    for (const auto& [start, end] : ranges) {
-        if (merged.empty()) {
-            merged.emplace_back(start, end);
-            continue;
-        }
-
-        auto& [m_start, m_end] = merged.back();
-        if (start > m_end + 1) {
-            merged.emplace_back(start, end);
-        } else {
-            m_end = std::max(m_end, end);
-        }
-    }
+    auto merged = merge_intervals(std::move(ranges));
 
     uint64_t result = 0;
     for(const auto&[start, end]: merged){
@@ -122,9 +111,32 @@ std::string Day05::part2(const std::string& input) {
     }
 
     
-    return std::to_string(result);
+    return result;
 }
 
-REGISTER_SOLUTION(Day05)
+// Ranges come before the blank line, IDs after it
+size_t Day05::scale_size(const std::string& input) const {
+    size_t count = 0;
+    for (const auto& line : split(input, '\n')) count += !line.empty();
+    return count;
+}
+
+std::string Day05::scale_input(const std::string& input, size_t n) const {
+    std::vector<std::string> ranges, ids;
+    bool in_ids = false;
+    for (const auto& line : split(input, '\n')) {
+        if (line.empty()) {
+            in_ids = true;
+            continue;
+        }
+        (in_ids ? ids : ranges).push_back(line);
+    }
+    const double share = double(n) / std::max<size_t>(1, ranges.size() + ids.size());
+    std::string out;
+    for (size_t i = 0; i < size_t(ranges.size() * share + 0.5); i++) out += ranges[i] + "\n";
+    out += "\n";
+    for (size_t i = 0; i < size_t(ids.size() * share + 0.5); i++) out += ids[i] + "\n";
+    return out;
+}
 
-} // namespace aoc::y2025
\ No newline at end of file
+} // namespace aoc::y2025
@@ -1,16 +1,29 @@
 #pragma once
 
 #include "common/solution.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 namespace aoc::y2025 {
 
+// Inclusive ID range [first, second]
+using Interval = std::pair<uint64_t, uint64_t>;
+
+// Sorted, disjoint, non-adjacent cover of `ranges`
+std::vector<Interval> merge_intervals(std::vector<Interval> ranges);
+
 class Day05 : public Solution {
 public:
-    std::string part1(const std::string& input) override;
-    std::string part2(const std::string& input) override;
+    Answer part1(const std::string& input) override;
+    Answer part2(const std::string& input) override;
     
     int year() const override { return 2025; }
     int day() const override { return 5; }
+    
+    // --scale keeps the same share of ranges and of IDs
+    size_t scale_size(const std::string& input) const override;
+    std::string scale_input(const std::string& input, size_t n) const override;
 };
 
 } // namespace aoc::y2025
@@ -1,5 +1,4 @@
 #include "solution.hpp"
-#include "common/registry.hpp"
 #include "common/utils.hpp"
 #include <vector>
 #include <algorithm>
@@ -7,14 +6,14 @@
 
 namespace aoc::y2025 {
 
-std::string Day06::part1(const std::string& input) {
+Answer Day06::part1(const std::string& input) {
     auto lines = split(input, '\n');
     
     while (!lines.empty() && lines.back().empty()) {
         lines.pop_back();
     }
     
-    if (lines.empty()) return "0";
+    if (lines.empty()) return 0;
     
     size_t max_width = 0;
     for (const auto& line : lines) {
@@ -86,17 +85,17 @@ std::string Day06::part1(const std::string& input) {
         grand_total += result;
     }
     
-    return std::to_string(grand_total);
+    return grand_total;
 }
 
-std::string Day06::part2(const std::string& input) {
+Answer Day06::part2(const std::string& input) {
     auto lines = split(input, '\n');
     
     while (!lines.empty() && lines.back().empty()) {
         lines.pop_back();
     }
     
-    if (lines.empty()) return "0";
+    if (lines.empty()) return 0;
     
     size_t max_width = 0;
     for (const auto& line : lines) {
@@ -167,9 +166,44 @@ std::string Day06::part2(const std::string& input) {
         grand_total += result;
     }
     
-    return std::to_string(grand_total);
+    return grand_total;
 }
 
-REGISTER_SOLUTION(Day06)
+namespace {
 
-} // namespace aoc::y2025
\ No newline at end of file
+// Column just past each problem; problems are separated by blank columns
+std::vector<size_t> problem_ends(const std::vector<std::string>& lines) {
+    size_t max_width = 0;
+    for (const auto& line : lines) max_width = std::max(max_width, line.size());
+    std::vector<bool> is_separator(max_width, true);
+    for (const auto& line : lines) {
+        for (size_t col = 0; col < line.size(); ++col) {
+            if (line[col] != ' ') is_separator[col] = false;
+        }
+    }
+    std::vector<size_t> ends;
+    for (size_t col = 0; col < max_width; ++col) {
+        if (!is_separator[col] && (col + 1 == max_width || is_separator[col + 1])) ends.push_back(col + 1);
+    }
+    return ends;
+}
+
+} // namespace
+
+size_t Day06::scale_size(const std::string& input) const {
+    return problem_ends(split(input, '\n')).size();
+}
+
+std::string Day06::scale_input(const std::string& input, size_t n) const {
+    auto lines = split(input, '\n');
+    auto ends = problem_ends(lines);
+    if (n == 0 || ends.empty()) return "";
+    const size_t cut = ends[std::min(n, ends.size()) - 1];
+    std::string out;
+    for (const auto& line : lines) {
+        if (!line.empty()) out += line.substr(0, cut) + "\n";
+    }
+    return out;
+}
+
+} // namespace aoc::y2025
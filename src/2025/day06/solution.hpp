@@ -6,11 +6,15 @@ namespace aoc::y2025 {
 
 class Day06 : public Solution {
 public:
-    std::string part1(const std::string& input) override;
-    std::string part2(const std::string& input) override;
+    Answer part1(const std::string& input) override;
+    Answer part2(const std::string& input) override;
     
     int year() const override { return 2025; }
     int day() const override { return 6; }
+    
+    // --scale counts problems (column blocks) and keeps the first n
+    size_t scale_size(const std::string& input) const override;
+    std::string scale_input(const std::string& input, size_t n) const override;
 };
 
 } // namespace aoc::y2025
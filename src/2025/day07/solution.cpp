@@ -1,12 +1,13 @@
 #include "solution.hpp"
-#include "common/registry.hpp"
 #include "common/utils.hpp"
+#include "common/bigint.hpp"
 #include <queue>
 #include <set>
+#include <stdexcept>
 
 namespace aoc::y2025 {
 
-std::string Day07::part1(const std::string& input) {
+Answer Day07::part1(const std::string& input) {
     auto lines = split(input);
 
     uint64_t result = 0;
@@ -59,57 +60,73 @@ std::string Day07::part1(const std::string& input) {
     }
     
     
-    return std::to_string(visited_splitters.size());
+    return visited_splitters.size();
 }
 
-// DFS with memoization
-uint64_t countTimeLines(int x, int y, std::map<std::pair<int, int>, int64_t>& memo, const std::vector<std::string>& lines, int width, int height) {
-    auto key = std::make_pair(x, y);
-
-    // Check memoization
-    if (memo.find(key) != memo.end()) {
-        return memo[key];
+bool Day07::set_variant(const std::string& name) {
+    if (name == "auto") counter_ = Counter::Auto;
+    else if (name == "u64") counter_ = Counter::U64;
+    else if (name == "u128") counter_ = Counter::U128;
+    else if (name == "big") counter_ = Counter::Big;
+    else if (name == "mod") { counter_ = Counter::Mod; modulus_ = 1000000007; }
+    else if (name.rfind("mod:", 0) == 0) {
+        const std::string digits = name.substr(4);
+        if (digits.empty() || digits.find_first_not_of("0123456789") != std::string::npos) return false;
+        uint64_t p = 0;
+        try {
+            p = std::stoull(digits);
+        } catch (const std::out_of_range&) {
+            return false;
+        }
+        if (p == 0) return false;
+        counter_ = Counter::Mod;
+        modulus_ = p;
     }
+    else return false;
+    return true;
+}
 
-    // Move down until we hit something
-    while (y + 1 < height) {
-        y++;
-        char current = lines[y][x];
-        if (current == '.' || current == '|') {
-            // Continue moving down
-            continue;
-        } else if (current == '^') {
-            // Record splitter and branch left and right
-            uint64_t left_time = 0;
-            uint64_t right_time = 0;
-            if (x - 1 >= 0) {
-                left_time = countTimeLines(x - 1, y, memo, lines, width, height);
-            }
-            if (x + 1 < width) {
-                right_time = countTimeLines(x + 1, y, memo, lines, width, height);
+// Row sweep: counts[x] holds the number of timelines whose beam is in
+// column x on the current row. A splitter hands its count to both
+// neighbouring columns, anything that is not free space absorbs it.
+// `add(acc, value)` accumulates one count into another; `one` is the
+// count of the single starting timeline in the counter's arithmetic.
+template <typename T, typename Add>
+T sweep_timelines(const std::vector<std::string>& lines, int start_x, Add add, const T& one = T(1)) {
+    const int width = lines[0].size();
+    const int height = lines.size();
+
+    std::vector<T> counts(width), next(width);
+    counts[start_x] = one;
+
+    for (int y = 1; y < height; ++y) {
+        const std::string& row = lines[y];
+        for (auto& c : next) c = T(0);
+        for (int x = 0; x < width; ++x) {
+            const T& c = counts[x];
+            if (c == T(0)) continue;
+            char current = x < static_cast<int>(row.size()) ? row[x] : '.';
+            if (current == '.' || current == '|') {
+                add(next[x], c);
+            } else if (current == '^') {
+                if (x - 1 >= 0) add(next[x - 1], c);
+                if (x + 1 < width) add(next[x + 1], c);
             }
-            memo[key] = left_time + right_time;
-            return memo[key];
-        } else {
-            memo[key] = 0;
-            return 0;
         }
+        std::swap(counts, next);
     }
-    return 1;
+
+    T total(0);
+    for (const auto& c : counts) add(total, c);
+    return total;
 }
 
-std::string Day07::part2(const std::string& input) {
+Answer Day07::part2(const std::string& input) {
     auto lines = split(input);
 
-    uint64_t result = 0;
-
-    char free_space = '.';
-    char splitter = '^';
     char start = 'S';
-    char beam = '|';
 
     int width = lines[0].size();
-    int height = lines.size();
     int start_x = 0;
     // Find start position
     for (int x = 0; x < width; ++x) {
@@ -118,15 +135,40 @@ std::string Day07::part2(const std::string& input) {
             break;
         }
     }
-    std::map<std::pair<int, int>, int64_t> memo;
-    uint64_t max_time = 0;
-    uint64_t time = countTimeLines(start_x, 0, memo, lines, width, height);
 
-
-    
-    return std::to_string(time);
+    switch (counter_) {
+    case Counter::Auto: {
+        bool overflow = false;
+        uint64_t time = sweep_timelines<uint64_t>(lines, start_x,
+            [&](uint64_t& acc, uint64_t v) { overflow |= __builtin_add_overflow(acc, v, &acc); });
+        if (!overflow) return time;
+        // Too many timelines for 64 bits, redo the sweep exactly
+        return sweep_timelines<BigUInt>(lines, start_x,
+            [](BigUInt& acc, const BigUInt& v) { acc += v; }).to_string();
+    }
+    case Counter::U64:
+        return sweep_timelines<uint64_t>(lines, start_x,
+            [](uint64_t& acc, uint64_t v) {
+                if (__builtin_add_overflow(acc, v, &acc)) throw std::overflow_error("timeline count overflows u64");
+            });
+    case Counter::U128:
+        return sweep_timelines<unsigned __int128>(lines, start_x,
+            [](unsigned __int128& acc, unsigned __int128 v) {
+                if (__builtin_add_overflow(acc, v, &acc)) throw std::overflow_error("timeline count overflows u128");
+            });
+    case Counter::Big:
+        return sweep_timelines<BigUInt>(lines, start_x,
+            [](BigUInt& acc, const BigUInt& v) { acc += v; }).to_string();
+    case Counter::Mod: {
+        const uint64_t m = modulus_;
+        return sweep_timelines<uint64_t>(lines, start_x,
+            [m](uint64_t& acc, uint64_t v) {
+                unsigned __int128 sum = (unsigned __int128)acc + v;
+                acc = uint64_t(sum >= m ? sum - m : sum);
+            }, uint64_t(1 % m));
+    }
+    }
+    return 0;
 }
 
-REGISTER_SOLUTION(Day07)
-
 } // namespace aoc::y2025
@@ -1,16 +1,34 @@
 #pragma once
 
 #include "common/solution.hpp"
+#include <cstdint>
 
 namespace aoc::y2025 {
 
 class Day07 : public Solution {
 public:
-    std::string part1(const std::string& input) override;
-    std::string part2(const std::string& input) override;
+    Answer part1(const std::string& input) override;
+    Answer part2(const std::string& input) override;
     
     int year() const override { return 2025; }
     int day() const override { return 7; }
+    
+    // Counter used for the part 2 timeline count:
+    //   auto   - uint64_t, promoted to big integers if the count overflows
+    //   u64    - plain uint64_t (throws if the count overflows)
+    //   u128   - unsigned __int128 (throws if the count overflows)
+    //   big    - arbitrary precision
+    //   mod    - count modulo 1000000007 (or mod:<p> for a custom modulus)
+    std::vector<std::string> variants() const override {
+        return {"auto", "u64", "u128", "big", "mod"};
+    }
+    bool set_variant(const std::string& name) override;
+    bool exact_variant(const std::string& name) const override { return name == "auto" || name == "big"; }
+    
+private:
+    enum class Counter { Auto, U64, U128, Big, Mod };
+    Counter counter_ = Counter::Auto;
+    uint64_t modulus_ = 1000000007;
 };
 
 } // namespace aoc::y2025
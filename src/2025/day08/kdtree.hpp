@@ -0,0 +1,192 @@
+#pragma once
+
+#include "common/thread_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace aoc::y2025 {
+
+using Point = std::array<int, 3>;
+
+// Grain for the per-point parallel loops
+constexpr size_t POINT_GRAIN = 256;
+
+struct Neighbor {
+    int64_t dist;
+    int idx;
+    
+    bool operator<(const Neighbor& other) const {
+        return dist < other.dist;
+    }
+};
+
+// Implicit-layout k-d tree.
+// Points are reordered so that the subtree for build range [lo, hi) is
+// stored contiguously with its splitting point at mid = (lo + hi) / 2 and
+// split dimension depth % 3; no child pointers are needed. Coordinates
+// live in SoA arrays in that build order.
+class KDTree {
+    static constexpr int MAX_STACK = 128;
+    
+    std::vector<int64_t> coords[3];
+    std::vector<int> ids;  // build position -> original point index
+    
+    void build(std::vector<int>& indices, const std::vector<Point>& points,
+               int start, int end, int depth) {
+        if (end - start <= 1) return;
+        
+        int dim = depth % 3;
+        int mid = (start + end) / 2;
+        
+        // (?) partial (?) sort to find median
+        std::nth_element(indices.begin() + start, indices.begin() + mid, indices.begin() + end,
+            [&](int a, int b) { return points[a][dim] < points[b][dim]; });
+        
+        build(indices, points, start, mid, depth + 1);
+        build(indices, points, mid + 1, end, depth + 1);
+    }
+    
+public:
+    KDTree(const std::vector<Point>& pts) {
+        int n = pts.size();
+        ids.resize(n);
+        for (int i = 0; i < n; i++) ids[i] = i;
+        build(ids, pts, 0, n, 0);
+        
+        for (int d = 0; d < 3; d++) {
+            coords[d].resize(n);
+            for (int i = 0; i < n; i++) coords[d][i] = pts[ids[i]][d];
+        }
+    }
+    
+    int size() const { return ids.size(); }
+    
+    // k nearest neighbours of `query`, skipping the point with original
+    // index `exclude`. Results go into `out` (room for k entries) as a
+    // max-heap on distance; returns how many were written. Iterative, with
+    // a fixed-size stack, and does not allocate.
+    int knn(const Point& query, int exclude, int k, Neighbor* out) const {
+        struct Frame { int lo, hi, depth; int64_t bound; };
+        Frame stack[MAX_STACK];
+        int top = 0;
+        int found = 0;
+        
+        const int64_t q[3] = {query[0], query[1], query[2]};
+        stack[top++] = {0, size(), 0, 0};
+        
+        while (top > 0) {
+            Frame f = stack[--top];
+            if (f.lo >= f.hi) continue;
+            // Only visit the far side of a split if it can hold closer points
+            if (found == k && f.bound >= out[0].dist) continue;
+            
+            int mid = (f.lo + f.hi) / 2;
+            int idx = ids[mid];
+            if (idx != exclude) {
+                int64_t dx = coords[0][mid] - q[0];
+                int64_t dy = coords[1][mid] - q[1];
+                int64_t dz = coords[2][mid] - q[2];
+                int64_t d = dx*dx + dy*dy + dz*dz;
+                if (found < k) {
+                    out[found++] = {d, idx};
+                    std::push_heap(out, out + found);
+                } else if (d < out[0].dist) {
+                    std::pop_heap(out, out + k);
+                    out[k - 1] = {d, idx};
+                    std::push_heap(out, out + k);
+                }
+            }
+            
+            int dim = f.depth % 3;
+            int64_t diff = q[dim] - coords[dim][mid];
+            Frame left{f.lo, mid, f.depth + 1, 0};
+            Frame right{mid + 1, f.hi, f.depth + 1, 0};
+            Frame& near = diff < 0 ? left : right;
+            Frame& far = diff < 0 ? right : left;
+            far.bound = std::max(f.bound, diff * diff);
+            near.bound = f.bound;
+            
+            // Far side first so the near side is searched before it
+            stack[top++] = far;
+            stack[top++] = near;
+        }
+        return found;
+    }
+    
+    // k nearest neighbours of every point, answered in parallel.
+    // Row i of `out` (k entries, max-heap order) belongs to point i;
+    // `counts[i]` is the number of neighbours written.
+    void knn_all(const std::vector<Point>& pts, int k, Neighbor* out, int* counts) const {
+        parallel_for(pts.size(), [&](int i) {
+            counts[i] = knn(pts[i], i, k, out + size_t(i) * k);
+        }, POINT_GRAIN);
+    }
+    
+    // Label every subtree with the component all of its points belong to,
+    // or -1 if it is mixed. `comp` is indexed by original point index; the
+    // label of range [lo, hi) is stored at its midpoint.
+    int label_components(const int* comp, int* node_comp, int lo, int hi) const {
+        if (lo >= hi) return -2;
+        int mid = (lo + hi) / 2;
+        int c = comp[ids[mid]];
+        int l = label_components(comp, node_comp, lo, mid);
+        int r = label_components(comp, node_comp, mid + 1, hi);
+        if ((l != -2 && l != c) || (r != -2 && r != c)) c = -1;
+        node_comp[mid] = c;
+        return c;
+    }
+    
+    // Nearest point to `query` outside component `own`, ignoring anything
+    // farther than `limit`. Subtrees labelled `own` are skipped entirely.
+    // Equal distances resolve to the smaller index. Returns {limit, -1}
+    // when nothing qualifies.
+    Neighbor nearest_foreign(const Point& query, int own, const int* comp,
+                             const int* node_comp, int64_t limit) const {
+        struct Frame { int lo, hi, depth; int64_t bound; };
+        Frame stack[MAX_STACK];
+        int top = 0;
+        Neighbor best{limit, -1};
+        
+        const int64_t q[3] = {query[0], query[1], query[2]};
+        stack[top++] = {0, size(), 0, 0};
+        
+        while (top > 0) {
+            Frame f = stack[--top];
+            if (f.lo >= f.hi || f.bound > best.dist) continue;
+            
+            int mid = (f.lo + f.hi) / 2;
+            if (node_comp[mid] == own) continue;
+            
+            int idx = ids[mid];
+            if (comp[idx] != own) {
+                int64_t dx = coords[0][mid] - q[0];
+                int64_t dy = coords[1][mid] - q[1];
+                int64_t dz = coords[2][mid] - q[2];
+                int64_t d = dx*dx + dy*dy + dz*dz;
+                if (d < best.dist || (d == best.dist && (best.idx == -1 || idx < best.idx))) {
+                    best = {d, idx};
+                }
+            }
+            
+            int dim = f.depth % 3;
+            int64_t diff = q[dim] - coords[dim][mid];
+            Frame left{f.lo, mid, f.depth + 1, f.bound};
+            Frame right{mid + 1, f.hi, f.depth + 1, f.bound};
+            Frame& near = diff < 0 ? left : right;
+            Frame& far = diff < 0 ? right : left;
+            far.bound = std::max(f.bound, diff * diff);
+            
+            stack[top++] = far;
+            stack[top++] = near;
+        }
+        return best;
+    }
+};
+
+// One point per "x,y,z" line
+std::vector<Point> parse_points(const std::string& input);
+
+} // namespace aoc::y2025
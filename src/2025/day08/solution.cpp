@@ -1,228 +1,452 @@
 #include "solution.hpp"
-#include "common/registry.hpp"
+#include "kdtree.hpp"
+#include "common/cpu_dispatch.hpp"
 #include "common/utils.hpp"
+#include "common/thread_pool.hpp"
+#include "common/union_find.hpp"
 #include <vector>
 #include <queue>
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <map>
+#include <cmath>
+#include <stdexcept>
 
 namespace aoc::y2025 {
 
-struct UnionFind {
-    std::vector<int> parent;
-    std::vector<int> rank;
+std::vector<Point> parse_points(const std::string& input) {
+    auto lines = split(input);
     
-    UnionFind(int n) : parent(n), rank(n, 0) {
-        for (int i = 0; i < n; i++) parent[i] = i;
+    std::vector<Point> nodes;
+    for (const auto& line : lines) {
+        if (line.empty()) continue;
+        auto coords = split(line, ',');
+        nodes.push_back({stoi(coords[0]), stoi(coords[1]), stoi(coords[2])});
     }
+    return nodes;
+}
+
+// Total order on edges so the exact selection is deterministic under ties
+inline bool edge_less(const edge& a, const edge& b) {
+    if (a.weight != b.weight) return a.weight < b.weight;
+    if (a.a != b.a) return a.a < b.a;
+    return a.b < b.b;
+}
+
+// Candidate edges from each point's 7 nearest neighbours, sorted.
+// A pair can only be missing if both endpoints have full lists whose k-th
+// neighbour is no farther than the pair, so every pair shorter than the
+// nearest such k-th neighbour is a candidate: `exact_prefix` counts those
+// edges, the part of the stream that matches the full one.
+struct KnnCandidates {
+    std::vector<edge> edges;
+    size_t exact_prefix;
+};
+
+KnnCandidates knn_edges(const std::vector<Point>& nodes) {
+    int n = nodes.size();
+    KDTree tree(nodes);
+    const int k = 7;
+    
+    std::vector<Neighbor> neighbors(size_t(n) * k);
+    std::vector<int> counts(n);
+    tree.knn_all(nodes, k, neighbors.data(), counts.data());
+    
+    KnnCandidates result;
+    auto& edges = result.edges;
+    edges.reserve(size_t(n) * k);
+    int64_t bound = INT64_MAX;
     
-    int find(int x) {
-        if (parent[x] != x) {
-            parent[x] = find(parent[x]); 
+    for (int i = 0; i < n; i++) {
+        const Neighbor* row = neighbors.data() + size_t(i) * k;
+        for (int r = 0; r < counts[i]; r++) {
+            int j = row[r].idx;
+            edges.push_back({std::min(i, j), std::max(i, j), row[r].dist});
         }
-        return parent[x];
+        // row[0] is the heap top, i.e. the k-th nearest neighbour
+        if (counts[i] == k) bound = std::min(bound, row[0].dist);
     }
     
-    bool unite(int x, int y) {
-        int px = find(x);
-        int py = find(y);
-        if (px == py) return false;  // already same circuit
-        if (rank[px] < rank[py]) std::swap(px, py);
-        parent[py] = px;
-        if (rank[px] == rank[py]) rank[px]++;
-        return true;
-    }
-};
-
-struct edge {
-    int a, b;           
-    int64_t weight;
+    // Lists need not be symmetric: keep each pair once, in the total order
+    std::sort(edges.begin(), edges.end(), edge_less);
+    edges.erase(std::unique(edges.begin(), edges.end(), [](const edge& a, const edge& b) {
+        return a.a == b.a && a.b == b.b;
+    }), edges.end());
     
-    bool operator>(const edge& other) const {
-        return weight > other.weight;
+    result.exact_prefix = std::lower_bound(edges.begin(), edges.end(), bound, [](const edge& e, int64_t w) {
+        return e.weight < w;
+    }) - edges.begin();
+    return result;
+}
+
+// Squared distances from (xi, yi, zi) to len SoA points. One plain loop,
+// vectorised by the compiler once per instruction set: the wrappers below
+// only add a target attribute and inline the body.
+using DistanceKernel = void (*)(const double* px, const double* py, const double* pz,
+                                double xi, double yi, double zi, int len, double* out);
+
+inline __attribute__((always_inline))
+void squared_distances_body(const double* __restrict__ px, const double* __restrict__ py,
+                            const double* __restrict__ pz, double xi, double yi, double zi,
+                            int len, double* __restrict__ out) {
+    for (int j = 0; j < len; j++) {
+        const double dx = px[j] - xi;
+        const double dy = py[j] - yi;
+        const double dz = pz[j] - zi;
+        out[j] = dx * dx + dy * dy + dz * dz;
     }
-};
+}
 
-using Point = std::array<int, 3>;
+void squared_distances_scalar(const double* px, const double* py, const double* pz,
+                              double xi, double yi, double zi, int len, double* out) {
+    squared_distances_body(px, py, pz, xi, yi, zi, len, out);
+}
 
-// K-d tree node
-struct KDNode {
-    int point_idx;
-    int split_dim;
-    KDNode* left = nullptr;
-    KDNode* right = nullptr;
-};
+#ifdef AOC_X86
+AOC_TARGET_AVX2
+void squared_distances_avx2(const double* px, const double* py, const double* pz,
+                            double xi, double yi, double zi, int len, double* out) {
+    squared_distances_body(px, py, pz, xi, yi, zi, len, out);
+}
+
+AOC_TARGET_AVX512
+void squared_distances_avx512(const double* px, const double* py, const double* pz,
+                              double xi, double yi, double zi, int len, double* out) {
+    squared_distances_body(px, py, pz, xi, yi, zi, len, out);
+}
+#endif
 
-class KDTree {
-    std::vector<Point>& points;
-    KDNode* root = nullptr;
-    std::vector<KDNode> node_pool;
-    int pool_idx = 0;
+// No SSE4.2 entry: the baseline build already vectorises doubles with SSE2
+const IsaKernels<DistanceKernel> distance_kernels{
+    squared_distances_scalar, nullptr, AOC_IF_X86(squared_distances_avx2), AOC_IF_X86(squared_distances_avx512)};
+
+// Exact selection of the `count` globally shortest pairs (i < j).
+// The pairwise distance matrix is walked in BLOCK x BLOCK tiles of its upper
+// triangle: for a tile, the BLOCK column points (3 x 2 KiB of coordinates)
+// stay in L1 while every row point of the tile is measured against them.
+// Each row of a tile is computed into a flat buffer by the best distance
+// kernel for the CPU, then filtered into a per-thread bounded max-heap.
+// Threads pull tile rows from a shared counter and their heaps are merged
+// at the end.
+// Distances are computed in double, which is exact while squared distances
+// stay below 2^53: with |coordinate| < 2^24 a coordinate difference is
+// below 2^25 and the sum of three squares below 3 * 2^50.
+std::vector<edge> shortest_pairs(const std::vector<Point>& nodes, size_t count) {
+    constexpr int BLOCK = 256;
+    const int n = nodes.size();
     
-    KDNode* build(std::vector<int>& indices, int start, int end, int depth) {
-        if (start >= end) return nullptr;
-        
-        int dim = depth % 3;
-        int mid = (start + end) / 2;
-        
-        // (?) partial (?) sort to find median
-        std::nth_element(indices.begin() + start, indices.begin() + mid, indices.begin() + end,
-            [&](int a, int b) { return points[a][dim] < points[b][dim]; });
-        
-        KDNode* node = &node_pool[pool_idx++];
-        node->point_idx = indices[mid];
-        node->split_dim = dim;
-        node->left = build(indices, start, mid, depth + 1);
-        node->right = build(indices, mid + 1, end, depth + 1);
-        return node;
+    std::vector<double> xs(n), ys(n), zs(n);
+    for (int i = 0; i < n; i++) {
+        for (int d = 0; d < 3; d++) {
+            if (std::abs(nodes[i][d]) >= (1 << 24)) {
+                throw std::runtime_error("Coordinate too large for exact pair selection; "
+                                         "use the boruvka variant");
+            }
+        }
+        xs[i] = nodes[i][0];
+        ys[i] = nodes[i][1];
+        zs[i] = nodes[i][2];
     }
     
-    inline int64_t dist_sq(int i, int j) const {
-        int64_t dx = points[i][0] - points[j][0];
-        int64_t dy = points[i][1] - points[j][1];
-        int64_t dz = points[i][2] - points[j][2];
-        return dx*dx + dy*dy + dz*dz;
-    }
+    const size_t total_pairs = size_t(n) * (n - 1) / 2;
+    count = std::min(count, total_pairs);
+    if (count == 0) return {};
     
-    void knn_search(KDNode* node, int target, int k,
-                    std::priority_queue<std::pair<int64_t, int>>& best) const {
-        if (!node) return;
-        
-        int idx = node->point_idx;
-        if (idx != target) {
-            int64_t d = dist_sq(target, idx);
-            if (best.size() < (size_t)k) {
-                best.push({d, idx});
-            } else if (d < best.top().first) {
-                best.pop();
-                best.push({d, idx});
-            }
+    const int blocks = (n + BLOCK - 1) / BLOCK;
+    const DistanceKernel distances = distance_kernels.select();
+    auto heap_cmp = [](const edge& a, const edge& b) { return edge_less(a, b); };
+    
+    // Every runner keeps its own bounded max-heap of the best pairs so far
+    struct Runner {
+        std::vector<edge> heap;
+        std::vector<double> dist;
+    };
+    auto runners = parallel_for_state(blocks, 1, Runner{}, [&](Runner& runner, size_t b0, size_t b1) {
+        std::vector<edge>& heap = runner.heap;
+        std::vector<double>& dist = runner.dist;
+        if (dist.empty()) {
+            heap.reserve(count + 1);
+            dist.resize(BLOCK);
         }
         
-        int dim = node->split_dim;
-        int64_t diff = points[target][dim] - points[idx][dim];
-        int64_t diff_sq = diff * diff;
-        
-        KDNode* first = diff < 0 ? node->left : node->right;
-        KDNode* second = diff < 0 ? node->right : node->left;
-        
-        knn_search(first, target, k, best);
-        
-        // Only search other branch if closer points
-        if (best.size() < (size_t)k || diff_sq < best.top().first) {
-            knn_search(second, target, k, best);
+        for (int bi = b0; bi < int(b1); bi++) {
+            const int i_begin = bi * BLOCK, i_end = std::min(n, i_begin + BLOCK);
+            for (int tile = i_begin; tile < n; tile += BLOCK) {
+                const int tile_end = std::min(n, tile + BLOCK);
+                for (int i = i_begin; i < i_end; i++) {
+                    const int j0 = std::max(tile, i + 1);
+                    const int len = tile_end - j0;
+                    if (len <= 0) continue;
+                    const double xi = xs[i], yi = ys[i], zi = zs[i];
+                    double* out = dist.data();
+                    distances(xs.data() + j0, ys.data() + j0, zs.data() + j0, xi, yi, zi, len, out);
+                    
+                    double bound = heap.size() < count ? INFINITY : double(heap.front().weight);
+                    for (int j = 0; j < len; j++) {
+                        if (out[j] > bound) continue;
+                        edge e{i, j0 + j, int64_t(out[j])};
+                        if (heap.size() < count) {
+                            heap.push_back(e);
+                            std::push_heap(heap.begin(), heap.end(), heap_cmp);
+                        } else if (edge_less(e, heap.front())) {
+                            std::pop_heap(heap.begin(), heap.end(), heap_cmp);
+                            heap.back() = e;
+                            std::push_heap(heap.begin(), heap.end(), heap_cmp);
+                        } else {
+                            continue;
+                        }
+                        if (heap.size() == count) bound = double(heap.front().weight);
+                    }
+                }
+            }
         }
-    }
+    });
     
-public:
-    KDTree(std::vector<Point>& pts) : points(pts) {
-        int n = pts.size();
-        node_pool.resize(n);
-        std::vector<int> indices(n);
-        for (int i = 0; i < n; i++) indices[i] = i;
-        root = build(indices, 0, n, 0);
+    // Union of the runners' heaps, cut to the global best under the total order
+    std::vector<edge> edges;
+    edges.reserve(count * runners.size());
+    for (auto& runner : runners) edges.insert(edges.end(), runner.heap.begin(), runner.heap.end());
+    if (edges.size() > count) {
+        std::nth_element(edges.begin(), edges.begin() + count, edges.end(), edge_less);
+        edges.resize(count);
     }
+    std::sort(edges.begin(), edges.end(), edge_less);
+    return edges;
+}
+
+// Exact selection of the `count` shortest pairs from kNN lists, for point
+// clouds too large for the all-pairs kernel. With T the count-th shortest
+// candidate weight, a pair of weight <= T can only be missing if one of its
+// endpoints has k neighbours no farther than T; when every full list's k-th
+// neighbour is farther than T the candidates are complete. Otherwise k is
+// doubled and the lists rebuilt.
+std::vector<edge> shortest_pairs_knn(const std::vector<Point>& nodes, size_t count) {
+    const int n = nodes.size();
+    if (count == 0) return {};
+    KDTree tree(nodes);
     
-    // knn at index
-    std::vector<std::pair<int64_t, int>> knn(int target, int k) const {
-        std::priority_queue<std::pair<int64_t, int>> best;  // max-heap
-        knn_search(root, target, k, best);
+    for (int k = 8;; k = std::min(2 * k, n - 1)) {
+        std::vector<Neighbor> neighbors(size_t(n) * k);
+        std::vector<int> counts(n);
+        tree.knn_all(nodes, k, neighbors.data(), counts.data());
+        
+        std::vector<edge> edges;
+        edges.reserve(size_t(n) * k);
+        for (int i = 0; i < n; i++) {
+            const Neighbor* row = neighbors.data() + size_t(i) * k;
+            for (int r = 0; r < counts[i]; r++) {
+                int j = row[r].idx;
+                edges.push_back({std::min(i, j), std::max(i, j), row[r].dist});
+            }
+        }
+        std::sort(edges.begin(), edges.end(), edge_less);
+        edges.erase(std::unique(edges.begin(), edges.end(), [](const edge& a, const edge& b) {
+            return a.a == b.a && a.b == b.b;
+        }), edges.end());
+        
+        if (k == n - 1) {
+            if (edges.size() > count) edges.resize(count);
+            return edges;
+        }
+        if (edges.size() < count) continue;
         
-        std::vector<std::pair<int64_t, int>> result;
-        while (!best.empty()) {
-            result.push_back(best.top());
-            best.pop();
+        const int64_t threshold = edges[count - 1].weight;
+        bool complete = true;
+        for (int i = 0; i < n && complete; i++) {
+            // row[0] is the heap top, i.e. the k-th nearest neighbour
+            if (counts[i] == k && neighbors[size_t(i) * k].dist <= threshold) complete = false;
+        }
+        if (complete) {
+            edges.resize(count);
+            return edges;
         }
-        return result;
     }
-};
+}
 
-std::pair<int64_t, edge> solve(const std::string& input, int stop_after_connections) {
-    auto lines = split(input);
-    
-    std::vector<Point> nodes;
-    for (const auto& line : lines) {
-        if (line.empty()) continue;
-        auto coords = split(line, ',');
-        nodes.push_back({stoi(coords[0]), stoi(coords[1]), stoi(coords[2])});
-    }
-    
-    int n = nodes.size();
-    if (n <= 1) return {0, {-1, -1, 0}};
-    
+// Exact Euclidean MST by Borůvka rounds on the KD-tree.
+// Each round every point looks for its nearest point in another component
+// (in parallel, pruned by subtree component labels and by the best edge
+// its component has found so far), each component keeps its shortest
+// outgoing edge and those edges are merged. At most log2(n) rounds.
+std::vector<edge> euclidean_mst(const std::vector<Point>& nodes) {
+    const int n = nodes.size();
     KDTree tree(nodes);
-    const int k = 7;
+    ConcurrentUnionFind uf(n);
     
-    std::vector<edge> edges;
-    edges.reserve(n * k / 2);
+    std::vector<int> comp(n), node_comp(n);
+    for (int i = 0; i < n; i++) comp[i] = i;
+    std::vector<Neighbor> nearest(n);
+    std::vector<std::atomic<int64_t>> comp_best(n);
+    std::vector<edge> shortest(n);
+    std::vector<char> merged(n);
     
-    for (int i = 0; i < n; i++) {
-        auto neighbors = tree.knn(i, k);
-        for (auto& [dist, j] : neighbors) {
-            if (i < j) {  // avoid duplicates
-                edges.push_back({i, j, dist});
-            }
+    std::vector<edge> mst;
+    mst.reserve(n - 1);
+    
+    while ((int)mst.size() < n - 1) {
+        tree.label_components(comp.data(), node_comp.data(), 0, n);
+        for (auto& b : comp_best) b.store(INT64_MAX, std::memory_order_relaxed);
+        
+        parallel_for(n, [&](int i) {
+            auto& best = comp_best[comp[i]];
+            nearest[i] = tree.nearest_foreign(nodes[i], comp[i], comp.data(), node_comp.data(),
+                                              best.load(std::memory_order_relaxed));
+            int64_t d = nearest[i].dist;
+            int64_t cur = best.load(std::memory_order_relaxed);
+            while (nearest[i].idx != -1 && d < cur &&
+                   !best.compare_exchange_weak(cur, d, std::memory_order_relaxed)) {}
+        }, POINT_GRAIN);
+        
+        // Shortest outgoing edge per component, in the total edge order
+        std::fill(shortest.begin(), shortest.end(), edge{-1, -1, INT64_MAX});
+        for (int i = 0; i < n; i++) {
+            if (nearest[i].idx == -1) continue;
+            edge e{std::min(i, nearest[i].idx), std::max(i, nearest[i].idx), nearest[i].dist};
+            edge& cur = shortest[comp[i]];
+            if (cur.a == -1 || edge_less(e, cur)) cur = e;
+        }
+        
+        // Merge all chosen edges concurrently; two components choosing the
+        // same edge are merged (and the edge recorded) exactly once
+        parallel_for(n, [&](int c) {
+            const edge& e = shortest[c];
+            merged[c] = e.a != -1 && uf.unite(e.a, e.b);
+        }, POINT_GRAIN);
+        for (int c = 0; c < n; c++) {
+            if (merged[c]) mst.push_back(shortest[c]);
         }
+        parallel_for(n, [&](int i) { comp[i] = uf.find(i); }, POINT_GRAIN);
     }
     
-    std::sort(edges.begin(), edges.end(), [](const edge& a, const edge& b) {
-        return a.weight < b.weight;
-    });
-    
+    std::sort(mst.begin(), mst.end(), edge_less);
+    return mst;
+}
+
+ConnectivityHistory::ConnectivityHistory(int n, std::vector<edge> edges, size_t known_prefix)
+    : edges_(std::move(edges)), known_prefix_(std::min(known_prefix, edges_.size())) {
     UnionFind uf(n);
-    int connections_made = 0;
-    int mst_edges = 0;
-    edge last_mst_edge{-1, -1, 0};
+    // Circuit size -> number of circuits with that size
+    std::map<int, int> sizes{{1, n}};
     
-    for (const auto& e : edges) {
-        if (stop_after_connections > 0 && connections_made >= stop_after_connections) break;
-        if (stop_after_connections <= 0 && mst_edges >= n - 1) break;
-        
-        if (stop_after_connections > 0) {
-            // d1
-            uf.unite(e.a, e.b);
-            connections_made++;
-        } else {
-            // d2
-            if (uf.unite(e.a, e.b)) {
-                mst_edges++;
-                last_mst_edge = e;
-            }
+    auto snapshot = [&]() {
+        std::array<int, 3> top{0, 0, 0};
+        int filled = 0;
+        for (auto it = sizes.rbegin(); it != sizes.rend() && filled < 3; ++it) {
+            for (int c = 0; c < it->second && filled < 3; c++) top[filled++] = it->first;
         }
+        top3_.push_back(top);
+    };
+    auto remove_size = [&](int size) {
+        auto it = sizes.find(size);
+        if (--it->second == 0) sizes.erase(it);
+    };
+    
+    snapshot();
+    for (size_t i = 0; i < edges_.size() && uf.components() > 1; i++) {
+        const edge& e = edges_[i];
+        int sa = uf.size(e.a), sb = uf.size(e.b);
+        if (!uf.unite(e.a, e.b)) continue;
+        remove_size(sa);
+        remove_size(sb);
+        sizes[sa + sb]++;
+        merge_at_.push_back(i);
+        snapshot();
+        if (uf.components() == 1) completing_ = e;
     }
+}
+
+int64_t ConnectivityHistory::top3_product(size_t k) const {
+    if (k > known_prefix_) {
+        throw std::out_of_range("Only the first " + std::to_string(known_prefix_) +
+                                " connections are known");
+    }
+    // Merges made by stream positions [0, k)
+    size_t merges = std::lower_bound(merge_at_.begin(), merge_at_.end(), k) - merge_at_.begin();
+    int64_t result = 1;
+    for (int s : top3_[merges]) {
+        if (s > 0) result *= s;
+    }
+    return result;
+}
+
+ConnectivityHistory Day08::build_history(const std::vector<Point>& nodes, size_t connections) const {
+    const size_t n = nodes.size();
+    const size_t total_pairs = n * (n - 1) / 2;
     
-    if (stop_after_connections > 0) {
-        // d1
-        std::unordered_map<int, int> circuit_sizes;
-        for (int i = 0; i < n; i++) {
-            circuit_sizes[uf.find(i)]++;
+    switch (engine_) {
+    case Engine::Knn: {
+        // Answers are only given from the certified prefix of the candidates
+        auto candidates = knn_edges(nodes);
+        const size_t known = candidates.exact_prefix;
+        if (connections > known && known < total_pairs) {
+            throw std::runtime_error("knn candidates certify only the first " + std::to_string(known) +
+                                     " connections; use the boruvka or exact variant");
         }
-        
-        std::vector<int> sizes;
-        for (auto& p : circuit_sizes) {
-            sizes.push_back(p.second);
+        ConnectivityHistory history(n, std::move(candidates.edges), known);
+        if (connections == 0 && !history.completed_within(known)) {
+            throw std::runtime_error("knn candidates do not certify the spanning tree; "
+                                     "use the boruvka or exact variant");
         }
-        std::sort(sizes.rbegin(), sizes.rend());
-        
-        int64_t result = (int64_t)sizes[0] * sizes[1] * sizes[2];
-        return {result, {-1, -1, 0}};
-    } else {
-        // d2
-        int64_t result = (int64_t)nodes[last_mst_edge.a][0] * nodes[last_mst_edge.b][0];
-        return {result, last_mst_edge};
+        return history;
+    }
+    case Engine::Exact: {
+        // The connection queries only need the first `connections` pairs
+        if (connections > 0) {
+            const size_t count = std::min(connections, total_pairs);
+            return ConnectivityHistory(n, shortest_pairs(nodes, count), count);
+        }
+        // The shortest pairs are a prefix of the full stream, so Kruskal over
+        // them is exact as soon as they connect every point; otherwise double
+        // the candidate count and retry.
+        for (size_t count = std::min(4 * n, total_pairs);;
+             count = std::min(2 * count, total_pairs)) {
+            ConnectivityHistory history(n, shortest_pairs(nodes, count), count);
+            if (history.completing_edge().a != -1 || count == total_pairs) return history;
+        }
+    }
+    case Engine::Boruvka: {
+        // The connection queries only need the exact shortest pairs
+        if (connections > 0) {
+            auto edges = shortest_pairs_knn(nodes, connections);
+            const size_t known = edges.size();
+            return ConnectivityHistory(n, std::move(edges), known);
+        }
+        // Only MST edges ever merge circuits, so the MST alone yields the
+        // completing edge
+        return ConnectivityHistory(n, euclidean_mst(nodes), 0);
     }
+    }
+    return ConnectivityHistory(n, {}, 0);
+}
+
+ConnectivityHistory Day08::connectivity(const std::string& input, size_t connections) const {
+    return build_history(parse_points(input), connections);
 }
 
-std::string Day08::part1(const std::string& input) {
-    auto [result, _] = solve(input, 1000);
-    return std::to_string(result);
+bool Day08::set_variant(const std::string& name) {
+    if (name == "boruvka") engine_ = Engine::Boruvka;
+    else if (name == "exact") engine_ = Engine::Exact;
+    else if (name == "knn") engine_ = Engine::Knn;
+    else return false;
+    return true;
 }
 
-std::string Day08::part2(const std::string& input) {
-    auto [result, _] = solve(input, -1);
-    return std::to_string(result);
+Answer Day08::part1(const std::string& input) {
+    const size_t connections = 1000;
+    auto nodes = parse_points(input);
+    if (nodes.size() <= 1) return 0;
+    
+    auto history = build_history(nodes, connections);
+    return history.top3_product(std::min(connections, history.known_connections()));
 }
 
-REGISTER_SOLUTION(Day08)
+Answer Day08::part2(const std::string& input) {
+    auto nodes = parse_points(input);
+    if (nodes.size() <= 1) return 0;
+    
+    edge last = build_history(nodes, 0).completing_edge();
+    return (int64_t)nodes[last.a][0] * nodes[last.b][0];
+}
 
 } // namespace aoc::y2025
\ No newline at end of file
@@ -1,16 +1,83 @@
 #pragma once
 
 #include "common/solution.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
 
 namespace aoc::y2025 {
 
+struct edge {
+    int a, b;           
+    int64_t weight;
+    
+    bool operator>(const edge& other) const {
+        return weight > other.weight;
+    }
+};
+
+// Union-find merge history over a sorted edge stream.
+// The stream is replayed once; afterwards "top-3 circuit product after k
+// connections" is a binary search over the recorded merges.
+class ConnectivityHistory {
+public:
+    // `edges` must be sorted; only the first `known_prefix` of them are
+    // guaranteed to be the globally shortest pairs in order
+    ConnectivityHistory(int n, std::vector<edge> edges, size_t known_prefix);
+    
+    // Product of the three largest circuit sizes after the first k
+    // connections (fewer circuits multiply as if the rest had size 1).
+    // O(log n); k must not exceed known_connections().
+    int64_t top3_product(size_t k) const;
+    
+    // Edge that joined the last two circuits, or {-1, -1, 0} if the
+    // stream never connects everything
+    edge completing_edge() const { return completing_; }
+    
+    // Whether the last two circuits were joined within the first k edges
+    bool completed_within(size_t k) const {
+        return completing_.a != -1 && merge_at_.back() < k;
+    }
+    
+    size_t known_connections() const { return known_prefix_; }
+    
+private:
+    std::vector<edge> edges_;
+    size_t known_prefix_;
+    std::vector<size_t> merge_at_;          // stream position of each merge
+    std::vector<std::array<int, 3>> top3_;  // largest sizes after each merge
+    edge completing_{-1, -1, 0};
+};
+
 class Day08 : public Solution {
 public:
-    std::string part1(const std::string& input) override;
-    std::string part2(const std::string& input) override;
+    Answer part1(const std::string& input) override;
+    Answer part2(const std::string& input) override;
     
     int year() const override { return 2025; }
     int day() const override { return 8; }
+    
+    // boruvka - exact pairs from certified kNN lists for part 1, Euclidean MST by
+    //           Borůvka rounds for part 2; scales to millions of points
+    // exact   - globally shortest pairs from a blocked all-pairs distance kernel
+    // knn     - candidate edges from each point's 7 nearest neighbours (fast;
+    //           throws unless the answer lies within the certified prefix).
+    //           Selectable by name only: it cannot answer most inputs, so
+    //           "all" and --verify leave it out.
+    std::vector<std::string> variants() const override { return {"boruvka", "exact"}; }
+    bool set_variant(const std::string& name) override;
+    
+    // Build the edge stream and merge history once; the first `connections`
+    // positions can then be queried for any cutoff
+    ConnectivityHistory connectivity(const std::string& input, size_t connections) const;
+    
+private:
+    enum class Engine { Knn, Exact, Boruvka };
+    Engine engine_ = Engine::Boruvka;
+    
+    // connections == 0 asks for the completing edge (part 2) instead
+    ConnectivityHistory build_history(const std::vector<std::array<int, 3>>& nodes,
+                                      size_t connections) const;
 };
 
 } // namespace aoc::y2025
@@ -1,15 +1,24 @@
 #include "solution.hpp"
-#include "common/registry.hpp"
 #include "common/utils.hpp"
+#include "common/cpu_dispatch.hpp"
+#include "common/metrics.hpp"
+#include "common/thread_pool.hpp"
+#include "common/watchdog.hpp"
 #include <vector>
 #include <utility>
 #include <algorithm>
+#include <random>
 #include <set>
+#include <stdexcept>
+
+#ifdef AOC_X86
+#include <immintrin.h>
+#endif
 
 namespace aoc::y2025
 {
 
-std::string Day09::part1(const std::string &input) {
+Answer part1_reference(const std::string &input) {
     auto lines = split(input);
     const size_t n = lines.size();
     
@@ -36,40 +45,55 @@ std::string Day09::part1(const std::string &input) {
         }
     }
     
-    return std::to_string(max_area);
+    return max_area;
 }
 
 const char RED_TILE = '#';
 const char EMPTY_TILE = '.';
+const char OUTSIDE_TILE = 'o';
 
 struct point {
     int64_t x;
     int64_t y;
 };
 
-int get_index(const std::vector<uint64_t>& coordinates, uint64_t coordinate) {
-    return int(std::lower_bound(coordinates.begin(), coordinates.end(), coordinate) - coordinates.begin());
-}
-
-void dfs(std::vector<std::vector<char>>& grid, size_t x, size_t y, size_t n) {
-    if (x >= n || y >= n) return;
-    if (grid[x][y] == RED_TILE) return;
-
-    grid[x][y] = RED_TILE;
-
-    if (x + 1 < n) dfs(grid, x + 1, y, n);
-    if (x > 0)     dfs(grid, x - 1, y, n);
-    if (y + 1 < n) dfs(grid, x, y + 1, n);
-    if (y > 0)     dfs(grid, x, y - 1, n);
-}
+// One axis of a compressed grid: a cell per distinct coordinate, and one
+// for the gap up to the next coordinate when tiles lie strictly between
+// them. Coordinates one apart get no gap cell: such a gap holds no tiles,
+// and a cell for it would open a hole between tiles that are all red.
+struct CompressedAxis {
+    std::vector<int64_t> coords;        // distinct, ascending
+    std::vector<size_t> cell;           // cell of each coordinate
+    std::vector<size_t> before, after;  // per cell: last coordinate at or before it, first at or after
+    
+    explicit CompressedAxis(std::vector<int64_t> values) : coords(std::move(values)) {
+        std::sort(coords.begin(), coords.end());
+        coords.erase(std::unique(coords.begin(), coords.end()), coords.end());
+        cell.resize(coords.size());
+        for (size_t i = 0; i < coords.size(); i++) {
+            if (i > 0 && coords[i] - coords[i - 1] > 1) {
+                before.push_back(i - 1);  // the gap
+                after.push_back(i);
+            }
+            cell[i] = before.size();
+            before.push_back(i);
+            after.push_back(i);
+        }
+    }
+    
+    size_t size() const { return before.size(); }
+    size_t cell_of(int64_t coordinate) const {
+        return cell[std::lower_bound(coords.begin(), coords.end(), coordinate) - coords.begin()];
+    }
+};
 
-std::string Day09::part2(const std::string &input)
+Answer part2_reference(const std::string &input)
 {
     auto lines = split(input);
     const size_t n = lines.size();
     
     std::vector<point> points(n);
-    std::vector<uint64_t> x(n), y(n);
+    std::vector<int64_t> x(n), y(n);
     
     for (size_t i = 0; i < n; i++) {
         auto vals = split(lines[i], ',');
@@ -79,28 +103,33 @@ std::string Day09::part2(const std::string &input)
         y[i] = points[i].y;
     }
 
-    std::vector<uint64_t> sorted_x = x, sorted_y = y;
-    sort(sorted_x.begin(), sorted_x.end());
-    sort(sorted_y.begin(), sorted_y.end());
-
-    // Step 1: Create grid with compressed coordinates
-    std::vector<std::vector<char>> grid(n, std::vector<char>(n, EMPTY_TILE));
+    // Step 1: Create grid with compressed coordinates (see CompressedAxis)
+    const CompressedAxis x_axis(x), y_axis(y);
+    const size_t mx = x_axis.size(), my = y_axis.size();
+    auto x_cell = [&](int64_t v) { return x_axis.cell_of(v); };
+    auto y_cell = [&](int64_t v) { return y_axis.cell_of(v); };
+    std::vector<std::vector<char>> grid(mx, std::vector<char>(my, EMPTY_TILE));
+    std::vector<std::vector<char>> crossing(mx, std::vector<char>(my, 0));
     
     // Step 2: Rasterize polygon edges
     for (size_t i = 0; i < n; ++i) {
-        size_t x_idx = get_index(sorted_x, points[i].x);
-        size_t y_idx = get_index(sorted_y, points[i].y);
+        size_t x_idx = x_cell(points[i].x);
+        size_t y_idx = y_cell(points[i].y);
 
-        size_t x_next_idx = get_index(sorted_x, points[(i + 1) % n].x);
-        size_t y_next_idx = get_index(sorted_y, points[(i + 1) % n].y);
+        size_t x_next_idx = x_cell(points[(i + 1) % n].x);
+        size_t y_next_idx = y_cell(points[(i + 1) % n].y);
 
         if (x_idx == x_next_idx) {
-            // Vertical edge
+            // Vertical edge; it crosses the scanlines half-open in y so
+            // shared corners count once
             size_t y_lo = std::min(y_idx, y_next_idx);
             size_t y_hi = std::max(y_idx, y_next_idx);
             for (size_t yp = y_lo; yp <= y_hi; ++yp) {
                 grid[x_idx][yp] = RED_TILE;
             }
+            for (size_t yp = y_lo; yp < y_hi; ++yp) {
+                crossing[x_idx][yp] ^= 1;
+            }
         } else if (y_idx == y_next_idx) {
             // Horizontal edge
             size_t x_lo = std::min(x_idx, x_next_idx);
@@ -111,38 +140,39 @@ std::string Day09::part2(const std::string &input)
         }
     }
 
-    // Step 3: Flood fill interior
-    dfs(grid, n / 2, n / 2, n);
-
-    // Step 4: compute prefix sums -> gives O(1) range queries
-    std::vector<std::vector<int>> row_prefix(n, std::vector<int>(n + 1, 0));
-    std::vector<std::vector<int>> col_prefix(n + 1, std::vector<int>(n, 0));
-    
-    for (size_t i = 0; i < n; ++i) {
-        for (size_t j = 0; j < n; ++j) {
-            int is_red = (grid[i][j] == RED_TILE) ? 1 : 0;
-            row_prefix[i][j + 1] = row_prefix[i][j] + is_red;
+    // Step 3: Mark the outside by the even-odd rule along each scanline.
+    // A flood fill cannot do this: an outside pocket may reach the rest of
+    // the outside only through a gap that has no cell.
+    for (size_t j = 0; j < my; ++j) {
+        bool inside = false;
+        for (size_t i = 0; i < mx; ++i) {
+            if (!inside && grid[i][j] == EMPTY_TILE) grid[i][j] = OUTSIDE_TILE;
+            if (crossing[i][j]) inside = !inside;
         }
     }
-    for (size_t j = 0; j < n; ++j) {
-        for (size_t i = 0; i < n; ++i) {
-            int is_red = (grid[i][j] == RED_TILE) ? 1 : 0;
-            col_prefix[i + 1][j] = col_prefix[i][j] + is_red;
+
+    // Step 4: 2D prefix sums -> O(1) count of red cells in any rectangle.
+    // The whole rectangle is checked, not just its sides, since an outside
+    // pocket can lie wholly within red sides.
+    std::vector<std::vector<int>> prefix(mx + 1, std::vector<int>(my + 1, 0));
+    Metrics::instance().set_bytes("part 2 grid", 2 * mx * my * sizeof(char));
+    Metrics::instance().set_bytes("part 2 prefix table", (mx + 1) * (my + 1) * sizeof(int));
+    
+    for (size_t i = 0; i < mx; ++i) {
+        for (size_t j = 0; j < my; ++j) {
+            int is_red = (grid[i][j] != OUTSIDE_TILE) ? 1 : 0;
+            prefix[i + 1][j + 1] = prefix[i][j + 1] + prefix[i + 1][j] - prefix[i][j] + is_red;
         }
     }
     
-    auto row_all_red = [&](size_t row, size_t col1, size_t col2) -> bool {
-        int count = row_prefix[row][col2 + 1] - row_prefix[row][col1];
-        return count == static_cast<int>(col2 - col1 + 1);
-    };
-    
-    auto col_all_red = [&](size_t col, size_t row1, size_t row2) -> bool {
-        int count = col_prefix[row2 + 1][col] - col_prefix[row1][col];
-        return count == static_cast<int>(row2 - row1 + 1);
+    auto all_red = [&](size_t x1, size_t y1, size_t x2, size_t y2) -> bool {
+        int count = prefix[x2 + 1][y2 + 1] - prefix[x1][y2 + 1] - prefix[x2 + 1][y1] + prefix[x1][y1];
+        return count == static_cast<int>((x2 - x1 + 1) * (y2 - y1 + 1));
     };
 
     // Step 5: Find max rectangle - O(n^2) over all point pairs
     uint64_t max_area = 0;
+    progress_total(n);
     for (size_t i = 0; i < n; ++i) {
         for (size_t j = 0; j < n; ++j) {
             point p = points[i];
@@ -151,25 +181,463 @@ std::string Day09::part2(const std::string &input)
             uint64_t candidate_area = (std::abs(p.x - q.x) + 1) * (std::abs(p.y - q.y) + 1);
             if (candidate_area <= max_area) continue;
 
-            size_t x1_idx = get_index(sorted_x, std::min(p.x, q.x));
-            size_t x2_idx = get_index(sorted_x, std::max(p.x, q.x));
-            size_t y1_idx = get_index(sorted_y, std::min(p.y, q.y));
-            size_t y2_idx = get_index(sorted_y, std::max(p.y, q.y));
+            size_t x1_idx = x_cell(std::min(p.x, q.x));
+            size_t x2_idx = x_cell(std::max(p.x, q.x));
+            size_t y1_idx = y_cell(std::min(p.y, q.y));
+            size_t y2_idx = y_cell(std::max(p.y, q.y));
 
-            bool valid = row_all_red(x1_idx, y1_idx, y2_idx) &&
-                         row_all_red(x2_idx, y1_idx, y2_idx) &&
-                         col_all_red(y1_idx, x1_idx, x2_idx) &&
-                         col_all_red(y2_idx, x1_idx, x2_idx);
+            if (all_red(x1_idx, y1_idx, x2_idx, y2_idx)) {
+                max_area = candidate_area;
+            }
+        }
+        progress_advance();
+    }
+    
+    return max_area;
+}
 
-            if (valid) {
+// Largest rectangle with corners p (lower-left) and q (upper-right).
+// Only the lower-left staircase of points can be a useful p and only the
+// upper-right staircase a useful q. With both staircases sorted by x (and
+// so by decreasing y) the best q index is monotone in p, so a divide and
+// conquer over p finds every row maximum in O(m log m). Pairs where q is
+// below-left of p would get a positive product and break monotonicity, so
+// they are scored negative.
+int64_t max_area_north_east(std::vector<point> pts) {
+    if (pts.empty()) return 0;
+    
+    std::vector<point> lower, upper;
+    std::sort(pts.begin(), pts.end(), [](const point& a, const point& b) {
+        return a.x != b.x ? a.x < b.x : a.y < b.y;
+    });
+    for (const auto& p : pts) {
+        if (lower.empty() || p.y < lower.back().y) lower.push_back(p);
+    }
+    for (auto it = pts.rbegin(); it != pts.rend(); ++it) {
+        if (upper.empty() || it->y > upper.back().y) upper.push_back(*it);
+    }
+    std::reverse(upper.begin(), upper.end());
+    
+    auto score = [&](size_t i, size_t j) -> int64_t {
+        int64_t dx = upper[j].x - lower[i].x + 1;
+        int64_t dy = upper[j].y - lower[i].y + 1;
+        if (dx <= 0 && dy <= 0) return -dx * dy;
+        return dx * dy;
+    };
+    
+    int64_t best = 0;
+    // Iterative divide & conquer over (rows [lo, hi), candidate columns [opt_lo, opt_hi])
+    struct Range { size_t lo, hi, opt_lo, opt_hi; };
+    std::vector<Range> work{{0, lower.size(), 0, upper.size() - 1}};
+    while (!work.empty()) {
+        Range r = work.back();
+        work.pop_back();
+        if (r.lo >= r.hi) continue;
+        
+        size_t mid = (r.lo + r.hi) / 2;
+        size_t opt = r.opt_lo;
+        int64_t row_best = score(mid, opt);
+        for (size_t j = r.opt_lo + 1; j <= r.opt_hi; j++) {
+            int64_t v = score(mid, j);
+            if (v > row_best) {
+                row_best = v;
+                opt = j;
+            }
+        }
+        best = std::max(best, row_best);
+        work.push_back({r.lo, mid, r.opt_lo, opt});
+        work.push_back({mid + 1, r.hi, opt, r.opt_hi});
+    }
+    return best;
+}
+
+std::vector<point> parse_red_tiles(const std::string& input) {
+    auto lines = split(input);
+    std::vector<point> points;
+    points.reserve(lines.size());
+    for (const auto& line : lines) {
+        if (line.empty()) continue;
+        auto vals = split(line, ',');
+        points.push_back({int64_t(std::stoull(vals[0])), int64_t(std::stoull(vals[1]))});
+    }
+    return points;
+}
+
+Answer part1_staircase(const std::string& input) {
+    auto points = parse_red_tiles(input);
+    if (points.size() < 2) return 0;
+    
+    // Every pair is either north-east or north-west of each other;
+    // mirroring y turns the second case into the first
+    int64_t best = max_area_north_east(points);
+    for (auto& p : points) p.y = -p.y;
+    best = std::max(best, max_area_north_east(points));
+    
+    return best;
+}
+
+Answer part2_pruned(const std::string& input) {
+    auto points = parse_red_tiles(input);
+    const size_t n = points.size();
+    if (n == 0) return 0;
+    
+    // Compressed grid over the distinct coordinates (see CompressedAxis).
+    // Cells are looked up once per point, not per pair.
+    std::vector<int64_t> xs(n), ys(n);
+    for (size_t i = 0; i < n; i++) {
+        xs[i] = points[i].x;
+        ys[i] = points[i].y;
+    }
+    const CompressedAxis x_axis(std::move(xs)), y_axis(std::move(ys));
+    const size_t w = x_axis.size(), h = y_axis.size();
+    
+    std::vector<size_t> x_idx(n), y_idx(n);
+    for (size_t i = 0; i < n; i++) {
+        x_idx[i] = x_axis.cell_of(points[i].x);
+        y_idx[i] = y_axis.cell_of(points[i].y);
+    }
+    
+    // The summed-area table counts cells in uint32
+    if (uint64_t(w) * h > UINT32_MAX) {
+        throw std::runtime_error("compressed grid of " + std::to_string(w) + " x " + std::to_string(h) +
+                                 " cells is too large");
+    }
+    
+    // One byte per cell, one scanline (fixed y) after another: bit 0 = red
+    // (edge or interior), bit 1 = a vertical edge crosses the scanline
+    // through this cell
+    constexpr uint8_t RED = 1, CROSSING = 2;
+    std::vector<uint8_t> grid(w * h, 0);
+    auto cell = [&](size_t x, size_t y) -> uint8_t& { return grid[y * w + x]; };
+    
+    for (size_t i = 0; i < n; ++i) {
+        size_t j = (i + 1) % n;
+        size_t x1 = std::min(x_idx[i], x_idx[j]), x2 = std::max(x_idx[i], x_idx[j]);
+        size_t y1 = std::min(y_idx[i], y_idx[j]), y2 = std::max(y_idx[i], y_idx[j]);
+        if (x1 == x2) {
+            // Vertical edge; half-open in y so shared corners count once
+            for (size_t yp = y1; yp <= y2; ++yp) cell(x1, yp) |= RED;
+            for (size_t yp = y1; yp < y2; ++yp) cell(x1, yp) ^= CROSSING;
+        } else if (y1 == y2) {
+            for (size_t xp = x1; xp <= x2; ++xp) cell(xp, y1) |= RED;
+        }
+    }
+    
+    // Even-odd fill: a cell is inside when an odd number of vertical edges
+    // lie strictly to its left on its scanline
+    for (size_t y = 0; y < h; ++y) {
+        uint8_t* row = &cell(0, y);
+        bool inside = false;
+        for (size_t x = 0; x < w; ++x) {
+            if (inside) row[x] |= RED;
+            if (row[x] & CROSSING) inside = !inside;
+        }
+    }
+    
+    // Summed-area table: sat[(y + 1) * (w + 1) + (x + 1)] = red cells in [0, x] x [0, y]
+    std::vector<uint32_t> sat((w + 1) * (h + 1), 0);
+    for (size_t y = 0; y < h; ++y) {
+        const uint8_t* row = &cell(0, y);
+        const uint32_t* above = &sat[y * (w + 1)];
+        uint32_t* out = &sat[(y + 1) * (w + 1)];
+        uint32_t run = 0;  // red cells of this scanline in [0, x]
+        for (size_t x = 0; x < w; ++x) {
+            run += row[x] & RED;
+            out[x + 1] = above[x + 1] + run;
+        }
+    }
+    auto all_red = [&](size_t x1, size_t y1, size_t x2, size_t y2) -> bool {
+        uint64_t count = uint64_t(sat[(y2 + 1) * (w + 1) + x2 + 1]) - sat[(y2 + 1) * (w + 1) + x1]
+                       - sat[y1 * (w + 1) + x2 + 1] + sat[y1 * (w + 1) + x1];
+        return count == uint64_t(x2 - x1 + 1) * (y2 - y1 + 1);
+    };
+    
+    Metrics::instance().set_bytes("part 2 grid", grid.size() * sizeof(uint8_t));
+    Metrics::instance().set_bytes("part 2 summed-area table", sat.size() * sizeof(uint32_t));
+    
+    // Arms of each point: the last cells its row and column stay red for
+    // in each direction. A valid rectangle with corner p contains p's row
+    // and column sides, so its opposite corner lies inside p's arms. Red
+    // runs are found by binary search on the summed-area table.
+    auto last_red = [&](size_t from, size_t to, auto&& red) -> size_t {
+        // `red(k)` holds for k = from and is monotone towards `to`
+        while (from != to) {
+            size_t mid = from < to ? from + (to - from + 1) / 2 : from - (from - to + 1) / 2;
+            if (red(mid)) from = mid;
+            else to = mid < from ? mid + 1 : mid - 1;
+        }
+        return from;
+    };
+    struct Window { int64_t x1, y1, x2, y2; };
+    std::vector<Window> window(n);
+    std::vector<std::pair<uint64_t, size_t>> order(n);
+    for (size_t i = 0; i < n; i++) {
+        const size_t x = x_idx[i], y = y_idx[i];
+        size_t west = last_red(x, 0, [&](size_t k) { return all_red(k, y, x, y); });
+        size_t east = last_red(x, w - 1, [&](size_t k) { return all_red(x, y, k, y); });
+        size_t south = last_red(y, 0, [&](size_t k) { return all_red(x, k, x, y); });
+        size_t north = last_red(y, h - 1, [&](size_t k) { return all_red(x, y, x, k); });
+        // Corners sit on coordinate cells: round the arms inwards to one
+        window[i] = {x_axis.coords[x_axis.after[west]], y_axis.coords[y_axis.after[south]],
+                     x_axis.coords[x_axis.before[east]], y_axis.coords[y_axis.before[north]]};
+        
+        // Upper bound on any rectangle anchored at point i. Visiting points
+        // by decreasing bound lets the search stop once none can beat the best.
+        const point& p = points[i];
+        uint64_t reach_x = std::max(p.x - window[i].x1, window[i].x2 - p.x) + 1;
+        uint64_t reach_y = std::max(p.y - window[i].y1, window[i].y2 - p.y) + 1;
+        order[i] = {reach_x * reach_y, i};
+    }
+    std::sort(order.begin(), order.end(), std::greater<>());
+    
+    // Candidates for an anchor are the points inside its window, found as an
+    // x range of the points sorted by x. That is still O(n) per anchor when
+    // long arms cross many corners (a comb-shaped polygon), so the worst case
+    // stays O(n^2) lookups, plus the O(n^2) bytes of grid and table: about
+    // 465 MiB at 10k corners.
+    std::vector<size_t> by_x(n);
+    for (size_t i = 0; i < n; i++) by_x[i] = i;
+    std::sort(by_x.begin(), by_x.end(), [&](size_t a, size_t b) { return points[a].x < points[b].x; });
+    std::vector<int64_t> xs_sorted(n);
+    for (size_t k = 0; k < n; k++) xs_sorted[k] = points[by_x[k]].x;
+    
+    uint64_t max_area = 0;
+    progress_total(n);
+    for (const auto& [bound, i] : order) {
+        if (bound <= max_area) break;
+        const point& p = points[i];
+        const Window& win = window[i];
+        size_t k = std::lower_bound(xs_sorted.begin(), xs_sorted.end(), win.x1) - xs_sorted.begin();
+        size_t k_end = std::upper_bound(xs_sorted.begin(), xs_sorted.end(), win.x2) - xs_sorted.begin();
+        for (; k < k_end; ++k) {
+            const size_t j = by_x[k];
+            const point& q = points[j];
+            if (q.y < win.y1 || q.y > win.y2) continue;
+            uint64_t candidate_area = (std::abs(p.x - q.x) + 1) * (std::abs(p.y - q.y) + 1);
+            if (candidate_area <= max_area) continue;
+            
+            size_t x1 = std::min(x_idx[i], x_idx[j]), x2 = std::max(x_idx[i], x_idx[j]);
+            size_t y1 = std::min(y_idx[i], y_idx[j]), y2 = std::max(y_idx[i], y_idx[j]);
+            if (all_red(x1, y1, x2, y2)) {
                 max_area = candidate_area;
             }
         }
+        progress_advance();
+    }
+    
+    return max_area;
+}
+
+// Brute-force part 1 as a tiled, multi-threaded kernel over SoA uint32
+// coordinates. Tiles of TILE points (8 KiB of x and y each) stay in L1 while
+// a row of the pair matrix is swept against them.
+constexpr size_t TILE = 1024;
+
+using PairMaxKernel = uint64_t (*)(const uint32_t* xs, const uint32_t* ys,
+                                   size_t i0, size_t i1, size_t j0, size_t j1);
+
+// Max area over i in [i0, i1), j in [max(j0, i + 1), j1)
+uint64_t pair_max_scalar(const uint32_t* xs, const uint32_t* ys,
+                         size_t i0, size_t i1, size_t j0, size_t j1) {
+    uint64_t best = 0;
+    for (size_t i = i0; i < i1; i++) {
+        const uint64_t xi = xs[i], yi = ys[i];
+        for (size_t j = std::max(j0, i + 1); j < j1; j++) {
+            uint64_t dx = (xi > xs[j] ? xi - xs[j] : xs[j] - xi) + 1;
+            uint64_t dy = (yi > ys[j] ? yi - ys[j] : ys[j] - yi) + 1;
+            uint64_t area = dx * dy;
+            best = area > best ? area : best;
+        }
+    }
+    return best;
+}
+
+#ifdef AOC_X86
+// SIMD kernels. |a - b| is max - min on unsigned lanes, and mul_epu32
+// multiplies the even 32-bit lanes into 64-bit products, so even and odd
+// lanes are multiplied separately. Coordinates must be below 2^31 so
+// dx + 1 fits in 32 bits and products stay below 2^63 for the signed
+// 64-bit compares.
+
+// SSE4.2: 4 pairs per step
+AOC_TARGET_SSE42
+uint64_t pair_max_sse42(const uint32_t* xs, const uint32_t* ys,
+                        size_t i0, size_t i1, size_t j0, size_t j1) {
+    const __m128i one = _mm_set1_epi32(1);
+    __m128i vbest = _mm_setzero_si128();
+    uint64_t best = 0;
+    
+    for (size_t i = i0; i < i1; i++) {
+        const __m128i xi = _mm_set1_epi32(int(xs[i]));
+        const __m128i yi = _mm_set1_epi32(int(ys[i]));
+        size_t j = std::max(j0, i + 1);
+        for (; j + 4 <= j1; j += 4) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(xs + j));
+            __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ys + j));
+            __m128i dx = _mm_add_epi32(_mm_sub_epi32(_mm_max_epu32(x, xi), _mm_min_epu32(x, xi)), one);
+            __m128i dy = _mm_add_epi32(_mm_sub_epi32(_mm_max_epu32(y, yi), _mm_min_epu32(y, yi)), one);
+            __m128i even = _mm_mul_epu32(dx, dy);
+            __m128i odd = _mm_mul_epu32(_mm_srli_epi64(dx, 32), _mm_srli_epi64(dy, 32));
+            vbest = _mm_blendv_epi8(vbest, even, _mm_cmpgt_epi64(even, vbest));
+            vbest = _mm_blendv_epi8(vbest, odd, _mm_cmpgt_epi64(odd, vbest));
+        }
+        if (j < j1) best = std::max(best, pair_max_scalar(xs, ys, i, i + 1, j, j1));
+    }
+    
+    alignas(16) uint64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), vbest);
+    for (uint64_t v : lanes) best = std::max(best, v);
+    return best;
+}
+
+// AVX2: 8 pairs per step
+AOC_TARGET_AVX2
+uint64_t pair_max_avx2(const uint32_t* xs, const uint32_t* ys,
+                       size_t i0, size_t i1, size_t j0, size_t j1) {
+    const __m256i one = _mm256_set1_epi32(1);
+    __m256i vbest = _mm256_setzero_si256();
+    uint64_t best = 0;
+    
+    for (size_t i = i0; i < i1; i++) {
+        const __m256i xi = _mm256_set1_epi32(int(xs[i]));
+        const __m256i yi = _mm256_set1_epi32(int(ys[i]));
+        size_t j = std::max(j0, i + 1);
+        for (; j + 8 <= j1; j += 8) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xs + j));
+            __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ys + j));
+            __m256i dx = _mm256_add_epi32(_mm256_sub_epi32(_mm256_max_epu32(x, xi), _mm256_min_epu32(x, xi)), one);
+            __m256i dy = _mm256_add_epi32(_mm256_sub_epi32(_mm256_max_epu32(y, yi), _mm256_min_epu32(y, yi)), one);
+            __m256i even = _mm256_mul_epu32(dx, dy);
+            __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(dx, 32), _mm256_srli_epi64(dy, 32));
+            vbest = _mm256_blendv_epi8(vbest, even, _mm256_cmpgt_epi64(even, vbest));
+            vbest = _mm256_blendv_epi8(vbest, odd, _mm256_cmpgt_epi64(odd, vbest));
+        }
+        if (j < j1) best = std::max(best, pair_max_scalar(xs, ys, i, i + 1, j, j1));
+    }
+    
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), vbest);
+    for (uint64_t v : lanes) best = std::max(best, v);
+    return best;
+}
+
+// AVX-512: 16 pairs per step, with a native unsigned 64-bit max
+AOC_TARGET_AVX512
+uint64_t pair_max_avx512(const uint32_t* xs, const uint32_t* ys,
+                         size_t i0, size_t i1, size_t j0, size_t j1) {
+    // GCC's unmasked AVX-512 intrinsics blend into an uninitialized
+    // passthrough vector and trip -Wmaybe-uninitialized; the zero-masking
+    // forms with every lane enabled compile to the same instructions
+    const __mmask16 all32 = 0xffff;
+    const __mmask8 all64 = 0xff;
+    const __m512i one = _mm512_set1_epi32(1);
+    __m512i vbest = _mm512_setzero_si512();
+    uint64_t best = 0;
+    
+    for (size_t i = i0; i < i1; i++) {
+        const __m512i xi = _mm512_set1_epi32(int(xs[i]));
+        const __m512i yi = _mm512_set1_epi32(int(ys[i]));
+        size_t j = std::max(j0, i + 1);
+        for (; j + 16 <= j1; j += 16) {
+            __m512i x = _mm512_loadu_si512(xs + j);
+            __m512i y = _mm512_loadu_si512(ys + j);
+            __m512i dx = _mm512_add_epi32(_mm512_sub_epi32(_mm512_maskz_max_epu32(all32, x, xi),
+                                                           _mm512_maskz_min_epu32(all32, x, xi)), one);
+            __m512i dy = _mm512_add_epi32(_mm512_sub_epi32(_mm512_maskz_max_epu32(all32, y, yi),
+                                                           _mm512_maskz_min_epu32(all32, y, yi)), one);
+            vbest = _mm512_maskz_max_epu64(all64, vbest, _mm512_maskz_mul_epu32(all64, dx, dy));
+            vbest = _mm512_maskz_max_epu64(all64, vbest,
+                                           _mm512_maskz_mul_epu32(all64, _mm512_maskz_srli_epi64(all64, dx, 32),
+                                                                  _mm512_maskz_srli_epi64(all64, dy, 32)));
+        }
+        if (j < j1) best = std::max(best, pair_max_scalar(xs, ys, i, i + 1, j, j1));
+    }
+    alignas(64) uint64_t lanes[8];
+    _mm512_store_si512(lanes, vbest);
+    for (uint64_t lane : lanes) best = std::max(best, lane);
+    return best;
+}
+#endif
+
+const IsaKernels<PairMaxKernel> pair_max_kernels{
+    pair_max_scalar, AOC_IF_X86(pair_max_sse42), AOC_IF_X86(pair_max_avx2), AOC_IF_X86(pair_max_avx512)};
+
+Answer part1_simd(const std::string& input) {
+    auto points = parse_red_tiles(input);
+    const size_t n = points.size();
+    
+    std::vector<uint32_t> xs(n), ys(n);
+    for (size_t i = 0; i < n; i++) {
+        if (points[i].x < 0 || points[i].y < 0 || points[i].x >= (1LL << 31) || points[i].y >= (1LL << 31)) {
+            return part1_reference(input);  // coordinates too wide for the 32-bit lanes
+        }
+        xs[i] = uint32_t(points[i].x);
+        ys[i] = uint32_t(points[i].y);
     }
+    Isa isa;
+    PairMaxKernel kernel = pair_max_kernels.select(&isa);
+    Metrics::instance().set("part 1 kernel", isa_name(isa));
+    
+    // Upper-triangular tile pairs (ti <= tj), one row of tiles per chunk
+    const size_t tiles = (n + TILE - 1) / TILE;
+    uint64_t best = parallel_reduce(tiles, 1, uint64_t(0), [&](size_t first, size_t last) {
+        uint64_t row_best = 0;
+        for (size_t ti = first; ti < last; ti++) {
+            const size_t i0 = ti * TILE, i1 = std::min(n, i0 + TILE);
+            for (size_t tj = ti; tj < tiles; tj++) {
+                const size_t j0 = tj * TILE, j1 = std::min(n, j0 + TILE);
+                row_best = std::max(row_best, kernel(xs.data(), ys.data(), i0, i1, j0, j1));
+            }
+        }
+        return row_best;
+    }, [](uint64_t a, uint64_t b) { return std::max(a, b); });
     
-    return std::to_string(max_area);
+    return best;
+}
+
+size_t Day09::scale_size(const std::string& input) const {
+    return parse_red_tiles(input).size();
+}
+
+// Same shape as scripts/generate_input.py: columns of random width and
+// height over a common base, listed in order around the outline
+std::string Day09::scale_input(const std::string&, size_t n) const {
+    std::mt19937_64 rng(n);
+    const size_t columns = std::max<size_t>(2, n / 2 - 1);
+    std::vector<int64_t> xs{1};
+    for (size_t k = 0; k < columns; k++) xs.push_back(xs.back() + int64_t(1 + rng() % 500));
+    std::vector<int64_t> heights;
+    while (heights.size() < columns) {
+        int64_t h = 2 + int64_t(rng() % 99999);
+        if (heights.empty() || h != heights.back()) heights.push_back(h);
+    }
+    std::string out = std::to_string(xs.front()) + ",1\n" + std::to_string(xs.back()) + ",1\n";
+    for (size_t k = columns; k-- > 0;) {
+        out += std::to_string(xs[k + 1]) + "," + std::to_string(heights[k]) + "\n";
+        out += std::to_string(xs[k]) + "," + std::to_string(heights[k]) + "\n";
+    }
+    return out;
+}
+
+bool Day09::set_variant(const std::string& name) {
+    if (name == "fast") engine_ = Engine::Fast;
+    else if (name == "simd") engine_ = Engine::Simd;
+    else if (name == "reference") engine_ = Engine::Reference;
+    else return false;
+    return true;
 }
 
-REGISTER_SOLUTION(Day09)
+Answer Day09::part1(const std::string& input) {
+    switch (engine_) {
+    case Engine::Fast: return part1_staircase(input);
+    case Engine::Simd: return part1_simd(input);
+    case Engine::Reference: break;
+    }
+    return part1_reference(input);
+}
+
+Answer Day09::part2(const std::string& input) {
+    return engine_ == Engine::Reference ? part2_reference(input) : part2_pruned(input);
+}
 
 } // namespace aoc::y2025
\ No newline at end of file
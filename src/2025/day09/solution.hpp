@@ -6,11 +6,27 @@ namespace aoc::y2025 {
 
 class Day09 : public Solution {
 public:
-    std::string part1(const std::string& input) override;
-    std::string part2(const std::string& input) override;
+    Answer part1(const std::string& input) override;
+    Answer part2(const std::string& input) override;
     
     int year() const override { return 2025; }
     int day() const override { return 9; }
+    
+    // Cut-down corner lists aren't closed polygons, so --scale generates
+    // a rectilinear skyline with n corners instead
+    size_t scale_size(const std::string& input) const override;
+    std::string scale_input(const std::string& input, size_t n) const override;
+    
+    // fast      - staircase divide & conquer (part 1), bound-ordered pair search (part 2)
+    // simd      - all pairs for part 1 with a tiled, threaded AVX2 kernel (scalar
+    //             fallback when the CPU lacks AVX2); part 2 as in fast
+    // reference - the original all-pairs enumeration
+    std::vector<std::string> variants() const override { return {"fast", "simd", "reference"}; }
+    bool set_variant(const std::string& name) override;
+    
+private:
+    enum class Engine { Fast, Simd, Reference };
+    Engine engine_ = Engine::Fast;
 };
 
 } // namespace aoc::y2025
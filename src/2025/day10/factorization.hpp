@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Day 10 machine model and the target-independent factorizations behind
+// both parts. Shared by the solution and the kernel benchmarks.
+
+namespace aoc::y2025 {
+
+struct Machine {
+    std::vector<uint8_t> light_target;
+    std::vector<std::vector<uint16_t>> buttons;
+    std::vector<uint64_t> joltage_target;
+    
+    size_t num_lights() const { return light_target.size(); }
+    size_t num_joltages() const { return joltage_target.size(); }
+    size_t num_buttons() const { return buttons.size(); }
+};
+
+// One "[.##.] (0,3) (1,2) {3,5,4,7}" line
+Machine parse_machine(const std::string& line);
+
+// Bit-packed GF(2) matrix: each row is a run of 64-bit words, so row
+// operations are word-wise XORs.
+class GF2Matrix {
+public:
+    GF2Matrix() = default;
+    GF2Matrix(size_t rows, size_t cols) { reset(rows, cols); }
+    
+    // Resize to rows x cols and clear; keeps the allocation when it fits
+    void reset(size_t rows, size_t cols) {
+        rows_ = rows;
+        cols_ = cols;
+        stride_ = (cols + 63) / 64;
+        words_.assign(rows * stride_, 0);
+    }
+    
+    size_t rows() const { return rows_; }
+    size_t cols() const { return cols_; }
+    
+    bool get(size_t r, size_t c) const { return (row(r)[c >> 6] >> (c & 63)) & 1; }
+    void flip(size_t r, size_t c) { row(r)[c >> 6] ^= uint64_t(1) << (c & 63); }
+    
+    uint64_t* row(size_t r) { return words_.data() + r * stride_; }
+    const uint64_t* row(size_t r) const { return words_.data() + r * stride_; }
+    
+    void xor_row(size_t dst, size_t src) {
+        uint64_t* d = row(dst);
+        const uint64_t* s = row(src);
+        for (size_t w = 0; w < stride_; w++) d[w] ^= s[w];
+    }
+    
+    void swap_rows(size_t a, size_t b) {
+        if (a != b) std::swap_ranges(row(a), row(a) + stride_, row(b));
+    }
+    
+private:
+    size_t rows_ = 0, cols_ = 0, stride_ = 0;
+    std::vector<uint64_t> words_;
+};
+
+// Target-independent factorization of a light system: [A | I] reduced to
+// row echelon form. The identity half records the row operations T, so
+// for any pattern b the reduced right-hand side is just T * b.
+struct LightFactorization {
+    GF2Matrix reduced;  // buttons columns, then one column per light
+    std::vector<int> pivot_col;
+    std::vector<uint64_t> basis;  // null-space vectors, `words` each
+    size_t buttons = 0;
+    size_t words = 0;
+    size_t dimension = 0;
+    
+    size_t rank() const { return pivot_col.size(); }
+    const uint64_t* vector(size_t i) const { return basis.data() + i * words; }
+};
+
+// Eliminate the lights system with the buttons in `order` (a permutation
+// of the machine's buttons)
+LightFactorization factorize_gf2(const Machine& m, const std::vector<size_t>& order);
+
+// int64 arithmetic for the integer solver. Overflow throws instead of
+// wrapping, so a system too large for 64 bits is rejected, not solved wrong.
+inline int64_t checked_add(int64_t a, int64_t b) {
+    int64_t r;
+    if (__builtin_add_overflow(a, b, &r)) throw std::overflow_error("joltage system overflows 64-bit integers");
+    return r;
+}
+inline int64_t checked_sub(int64_t a, int64_t b) {
+    int64_t r;
+    if (__builtin_sub_overflow(a, b, &r)) throw std::overflow_error("joltage system overflows 64-bit integers");
+    return r;
+}
+inline int64_t checked_mul(int64_t a, int64_t b) {
+    int64_t r;
+    if (__builtin_mul_overflow(a, b, &r)) throw std::overflow_error("joltage system overflows 64-bit integers");
+    return r;
+}
+
+// Target-independent factorization of a joltage system. Reduced rows read
+//   pivot[r] * x[pivot_col[r]] + sum_f coef(r, f) * x[free_vars[f]] = (T * b)[r]
+// where T records the row operations; rows past the rank have A = 0 and
+// need (T * b)[r] = 0. Columns are in the canonical button order.
+struct JoltageFactorization {
+    std::vector<int> pivot_col;
+    std::vector<int64_t> pivot;
+    std::vector<int64_t> coefs;      // rank x free_vars.size(), row-major
+    std::vector<int64_t> transform;  // counters x counters, row-major
+    std::vector<int> free_vars;
+    size_t counters = 0;
+    
+    size_t rank() const { return pivot.size(); }
+    int64_t coef(size_t r, size_t f) const { return coefs[r * free_vars.size() + f]; }
+    
+    // (T * b)[r]
+    int64_t rhs(size_t r, const std::vector<uint64_t>& target) const {
+        int64_t sum = 0;
+        const int64_t* t = transform.data() + r * counters;
+        for (size_t c = 0; c < counters; c++) {
+            if (target[c] > uint64_t(INT64_MAX)) throw std::overflow_error("joltage system overflows 64-bit integers");
+            sum = checked_add(sum, checked_mul(t[c], int64_t(target[c])));
+        }
+        return sum;
+    }
+};
+
+JoltageFactorization factorize_integer(const Machine& m, const std::vector<size_t>& order);
+
+} // namespace aoc::y2025
@@ -1,6 +1,9 @@
 #include "solution.hpp"
-#include "common/registry.hpp"
+#include "factorization.hpp"
+#include "common/metrics.hpp"
+#include "common/thread_pool.hpp"
 #include "common/utils.hpp"
+#include "common/watchdog.hpp"
 #include <vector>
 #include <cstdint>
 #include <sstream>
@@ -8,19 +11,20 @@
 #include <iomanip>
 #include <algorithm>
 #include <limits>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <atomic>
+#include <exception>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace aoc::y2025 {
 
-struct Machine {
-    std::vector<uint8_t> light_target;
-    std::vector<std::vector<uint16_t>> buttons;
-    std::vector<uint64_t> joltage_target;
-    
-    size_t num_lights() const { return light_target.size(); }
-    size_t num_joltages() const { return joltage_target.size(); }
-    size_t num_buttons() const { return buttons.size(); }
-};
-
 Machine parse_machine(const std::string& line) {
     Machine m;
     size_t i = 0;
@@ -77,6 +81,99 @@ Machine parse_machine(const std::string& line) {
     }
     return m;
 }
+// Canonical form of a machine's wiring for a system with `rows` equations:
+// every button as a bitmask over the rows, masks sorted. `order` receives
+// the button indices in canonical order. GF(2) wiring XORs repeated indices,
+// integer wiring just sets them. Empty if the rows don't fit in a mask.
+std::vector<uint64_t> incidence_key(const Machine& m, size_t rows, bool xor_wiring,
+                                    std::vector<size_t>& order) {
+    std::vector<uint64_t> key;
+    order.resize(m.num_buttons());
+    std::iota(order.begin(), order.end(), 0);
+    if (rows > 64) return key;
+    
+    std::vector<uint64_t> masks(m.num_buttons(), 0);
+    for (size_t j = 0; j < m.num_buttons(); j++) {
+        for (uint16_t idx : m.buttons[j]) {
+            if (idx >= rows) continue;
+            uint64_t bit = uint64_t(1) << idx;
+            masks[j] = xor_wiring ? masks[j] ^ bit : masks[j] | bit;
+        }
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return masks[a] < masks[b]; });
+    
+    key.reserve(m.num_buttons() + 1);
+    key.push_back(rows);
+    for (size_t j : order) key.push_back(masks[j]);
+    return key;
+}
+
+struct IncidenceKeyHash {
+    size_t operator()(const std::vector<uint64_t>& key) const {
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for (uint64_t v : key) {
+            h ^= v;
+            h *= 0x100000001b3ULL;
+            h ^= h >> 29;
+        }
+        return h;
+    }
+};
+
+// Thread-safe map from canonical wiring to its target-independent
+// factorization. Two threads missing on the same key both factorize; the
+// first insert wins. Tracks hits and how long misses spent factorizing.
+template <typename Factorization>
+class FactorizationCache {
+public:
+    std::shared_ptr<const Factorization> find(const std::vector<uint64_t>& key) {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end()) return nullptr;
+        hits_++;
+        return it->second;
+    }
+    
+    std::shared_ptr<const Factorization> insert(std::vector<uint64_t> key,
+                                                std::shared_ptr<const Factorization> value,
+                                                std::chrono::nanoseconds build_time) {
+        misses_++;
+        build_ns_ += build_time.count();
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        return entries_.emplace(std::move(key), std::move(value)).first->second;
+    }
+    
+    // Hit rate and estimated time saved (hits x mean factorization time)
+    void report(const std::string& prefix) const {
+        const uint64_t hits = hits_, misses = misses_;
+        const uint64_t lookups = hits + misses;
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), "%llu/%llu hits (%.1f%%)", (unsigned long long)hits,
+                      (unsigned long long)lookups, lookups ? 100.0 * hits / lookups : 0.0);
+        Metrics::instance().set(prefix + " factorization cache", buf);
+        const double saved_us = misses ? double(build_ns_) / misses * hits / 1000.0 : 0.0;
+        std::snprintf(buf, sizeof(buf), "~%.0f µs", saved_us);
+        Metrics::instance().set(prefix + " factorization time saved", buf);
+    }
+    
+private:
+    std::shared_mutex mutex_;
+    std::unordered_map<std::vector<uint64_t>, std::shared_ptr<const Factorization>, IncidenceKeyHash> entries_;
+    std::atomic<uint64_t> hits_{0}, misses_{0}, build_ns_{0};
+};
+
+// Look up `key`, factorizing with `build` on a miss. A null cache or an
+// empty key (wiring too wide to canonicalise) always builds.
+template <typename Factorization, typename Build>
+std::shared_ptr<const Factorization> cached_factorization(FactorizationCache<Factorization>* cache,
+                                                          std::vector<uint64_t>& key, Build build) {
+    if (!cache || key.empty()) return std::make_shared<const Factorization>(build());
+    if (auto hit = cache->find(key)) return hit;
+    auto start = std::chrono::steady_clock::now();
+    auto value = std::make_shared<const Factorization>(build());
+    return cache->insert(std::move(key), std::move(value), std::chrono::steady_clock::now() - start);
+}
+
 using BitRow = std::vector<uint8_t>;
 using BitMatrix = std::vector<BitRow>;
 
@@ -195,6 +292,108 @@ int solve_part1(const Machine& m) {
     }
     return min_presses;
 }
+
+LightFactorization factorize_gf2(const Machine& m, const std::vector<size_t>& order) {
+    const size_t n = m.num_lights();
+    const size_t k = order.size();
+    LightFactorization f;
+    f.buttons = k;
+    f.words = (k + 63) / 64;
+    
+    GF2Matrix& mat = f.reduced;
+    mat.reset(n, k + n);
+    for (size_t j = 0; j < k; j++) {
+        for (uint16_t light_idx : m.buttons[order[j]]) {
+            if (light_idx < n) mat.flip(light_idx, j);
+        }
+    }
+    for (size_t i = 0; i < n; i++) mat.flip(i, k + i);
+    
+    std::vector<bool> is_pivot(k, false);
+    size_t rank = 0;
+    for (size_t col = 0; col < k && rank < n; col++) {
+        size_t pivot = rank;
+        while (pivot < n && !mat.get(pivot, col)) pivot++;
+        if (pivot == n) continue;
+        mat.swap_rows(pivot, rank);
+        for (size_t r = 0; r < n; r++) {
+            if (r != rank && mat.get(r, col)) mat.xor_row(r, rank);
+        }
+        f.pivot_col.push_back(col);
+        is_pivot[col] = true;
+        rank++;
+    }
+    
+    f.basis.assign((k - rank) * f.words, 0);
+    for (size_t c = 0; c < k; c++) {
+        if (is_pivot[c]) continue;
+        uint64_t* v = f.basis.data() + f.dimension * f.words;
+        v[c >> 6] |= uint64_t(1) << (c & 63);
+        for (size_t r = 0; r < rank; r++) {
+            if (mat.get(r, c)) v[f.pivot_col[r] >> 6] |= uint64_t(1) << (f.pivot_col[r] & 63);
+        }
+        f.dimension++;
+    }
+    return f;
+}
+
+// Fewest presses for the light pattern: walk the whole solution coset in
+// Gray-code order, so each step is one vector XOR and one popcount.
+// Holds its scratch buffers so one instance can solve many machines; the
+// factorization comes from `cache` when the wiring has been seen before.
+class LightSolver {
+public:
+    explicit LightSolver(FactorizationCache<LightFactorization>* cache = nullptr) : cache_(cache) {}
+    
+    // -1 if the pattern can't be reached
+    int64_t solve(const Machine& m) {
+        const size_t n = m.num_lights();
+        key_ = incidence_key(m, n, true, order_);
+        auto f = cached_factorization(cache_, key_, [&] { return factorize_gf2(m, order_); });
+        
+        // Right-hand side T * b: row r of the transform lives in columns k..k+n-1
+        const size_t k = f->buttons;
+        auto rhs_bit = [&](size_t r) {
+            bool bit = false;
+            for (size_t i = 0; i < n; i++) bit ^= m.light_target[i] && f->reduced.get(r, k + i);
+            return bit;
+        };
+        for (size_t r = f->rank(); r < n; r++) {
+            if (rhs_bit(r)) return -1;
+        }
+        x_.assign(f->words, 0);
+        for (size_t r = 0; r < f->rank(); r++) {
+            if (rhs_bit(r)) x_[f->pivot_col[r] >> 6] |= uint64_t(1) << (f->pivot_col[r] & 63);
+        }
+        
+        if (f->dimension >= 48) {
+            throw std::runtime_error("Too many free buttons to enumerate (" + std::to_string(f->dimension) + ")");
+        }
+        
+        auto weight = [this]() {
+            int total = 0;
+            for (uint64_t w : x_) total += __builtin_popcountll(w);
+            return total;
+        };
+        
+        int best = weight();
+        const uint64_t steps = uint64_t(1) << f->dimension;
+        for (uint64_t i = 1; i < steps; i++) {
+            if ((i & 0xffff) == 0) checkpoint();
+            const uint64_t* v = f->vector(__builtin_ctzll(i));
+            for (size_t w = 0; w < x_.size(); w++) x_[w] ^= v[w];
+            best = std::min(best, weight());
+        }
+        return best;
+    }
+    
+private:
+    FactorizationCache<LightFactorization>* cache_;
+    std::vector<uint64_t> key_;
+    std::vector<size_t> order_;
+    std::vector<uint64_t> x_;
+};
+
 using RealMatrix = std::vector<std::vector<double>>;
 const double EPS = 1e-9;
 
@@ -272,12 +471,11 @@ GaussianResultReal gaussian_elimination_real(RealMatrix mat, size_t num_vars) {
     return res;
 }
 
-int64_t min_total_presses = -1;
-
 void solve_recursive(const GaussianResultReal& gauss, 
                      const Machine& m,
                      std::vector<int64_t>& solution, 
-                     size_t free_idx) 
+                     size_t free_idx,
+                     int64_t& min_total_presses) 
 {
     // Base Case: All free variables assigned
     if (free_idx == gauss.free_vars.size()) {
@@ -312,10 +510,11 @@ void solve_recursive(const GaussianResultReal& gauss,
     }
     
     int f_col = gauss.free_vars[free_idx];
+    checkpoint();
     
     for (int64_t val = 0; val <= 199; val++) { 
         solution[f_col] = val;
-        solve_recursive(gauss, m, solution, free_idx + 1);
+        solve_recursive(gauss, m, solution, free_idx + 1, min_total_presses);
         
     }
 }
@@ -339,36 +538,350 @@ int64_t solve_part2_machine(const Machine& m) {
     
     if (!gauss.solvable) return 0; // Return 0 if no solution? Or -1? Problem implies solution exists.
     
-    min_total_presses = -1;
+    int64_t min_total_presses = -1;
     std::vector<int64_t> solution(cols, 0);
     
-    solve_recursive(gauss, m, solution, 0);
+    solve_recursive(gauss, m, solution, 0, min_total_presses);
     
     return (min_total_presses == -1) ? 0 : min_total_presses;
 }
 
-std::string Day10::part1(const std::string& input) {
-    auto lines = split(input);
+// Exact integer solver for part 2: minimise sum(x) subject to A x = b,
+// x >= 0 integer, where A[c][j] = 1 when button j feeds counter c.
+
+// Fraction-free Gauss-Jordan elimination of [A | I] over the integers.
+// Each row update is row_r = p * row_r - a * row_pivot followed by
+// division by the row's gcd, so entries stay small and everything is
+// exact; an update that would overflow throws. `order` gives the button
+// behind each column.
+JoltageFactorization factorize_integer(const Machine& m, const std::vector<size_t>& order) {
+    const size_t rows = m.num_joltages();
+    const size_t cols = order.size();
+    const size_t stride = cols + rows;
+    std::vector<int64_t> mat(rows * stride, 0);
+    auto row = [&](size_t r) { return mat.data() + r * stride; };
+    
+    for (size_t j = 0; j < cols; j++) {
+        for (uint16_t c_idx : m.buttons[order[j]]) {
+            if (c_idx < rows) row(c_idx)[j] = 1;
+        }
+    }
+    for (size_t i = 0; i < rows; i++) row(i)[cols + i] = 1;
+    
+    auto normalise = [stride](int64_t* r) {
+        int64_t g = 0;
+        for (size_t c = 0; c < stride; c++) g = std::gcd(g, r[c] < 0 ? -r[c] : r[c]);
+        if (g > 1) {
+            for (size_t c = 0; c < stride; c++) r[c] /= g;
+        }
+    };
+    
+    JoltageFactorization f;
+    f.counters = rows;
+    size_t pivot_row = 0;
+    for (size_t col = 0; col < cols; col++) {
+        // Smallest non-zero pivot keeps the multipliers small
+        int pivot = -1;
+        for (size_t r = pivot_row; r < rows; r++) {
+            if (row(r)[col] != 0 && (pivot == -1 || std::abs(row(r)[col]) < std::abs(row(pivot)[col]))) {
+                pivot = r;
+            }
+        }
+        if (pivot == -1) {
+            f.free_vars.push_back(col);
+            continue;
+        }
+        
+        if (size_t(pivot) != pivot_row) std::swap_ranges(row(pivot), row(pivot) + stride, row(pivot_row));
+        int64_t* prow = row(pivot_row);
+        if (prow[col] < 0) {
+            for (size_t c = 0; c < stride; c++) prow[c] = -prow[c];
+        }
+        for (size_t r = 0; r < rows; r++) {
+            int64_t* cur = row(r);
+            if (r == pivot_row || cur[col] == 0) continue;
+            int64_t p = prow[col], a = cur[col];
+            for (size_t c = 0; c < stride; c++) cur[c] = checked_sub(checked_mul(p, cur[c]), checked_mul(a, prow[c]));
+            normalise(cur);
+        }
+        f.pivot_col.push_back(col);
+        pivot_row++;
+    }
+    
+    for (size_t r = 0; r < rows; r++) {
+        int64_t* cur = row(r);
+        if (r < pivot_row) {
+            if (cur[f.pivot_col[r]] < 0) {
+                for (size_t c = 0; c < stride; c++) cur[c] = -cur[c];
+            }
+            f.pivot.push_back(cur[f.pivot_col[r]]);
+            for (int v : f.free_vars) f.coefs.push_back(cur[v]);
+        }
+        f.transform.insert(f.transform.end(), cur + cols, cur + stride);
+    }
+    return f;
+}
+
+// Branch and bound over the free variables.
+// Pivot variables follow from the free ones, so the objective is affine
+// in them: L * total = base + sum_f weight[f] * x_f with L = lcm(pivots).
+// At each node the bound relaxes the unassigned variables to their boxes
+// [0, upper[f]]: that gives a lower bound on the objective and, per row, the
+// feasible interval for the next variable. Leaves check integrality.
+//
+// The box relaxation stands in for a full LP bound. It is weaker (it
+// ignores how the rows couple the free variables), but machines have only a
+// handful of free variables, so trees stay small. It costs O(free vars)
+// per node against a simplex solve, and it is exact integer arithmetic with
+// no floating-point tolerance in the pruning test. Overflow of the
+// objective and residuals is ruled out once up front: every value the
+// search forms is bounded by |base| + sum |weight| * upper, or per row by
+// |residual| + sum |coef| * upper.
+class IntegerSearch {
+public:
+    // Minimum total presses, or nothing if the search space is exhausted.
+    // `order` maps the factorization's columns to this machine's buttons.
+    std::optional<int64_t> run(const JoltageFactorization& f, const Machine& m,
+                               const std::vector<size_t>& order) {
+        f_ = &f;
+        const size_t rank = f.rank();
+        const size_t nfree = f.free_vars.size();
+        
+        // Rows with A = 0 must have a zero right-hand side
+        for (size_t r = rank; r < f.counters; r++) {
+            if (f.rhs(r, m.joltage_target) != 0) return std::nullopt;
+        }
+        residual_.resize(rank);
+        for (size_t r = 0; r < rank; r++) residual_[r] = f.rhs(r, m.joltage_target);
+        
+        // A button can't be pressed more often than any counter it feeds allows
+        upper_.resize(nfree);
+        for (size_t v = 0; v < nfree; v++) {
+            int64_t ub = 0;
+            bool any = false;
+            for (uint16_t c : m.buttons[order[f.free_vars[v]]]) {
+                if (c >= m.num_joltages()) continue;
+                ub = any ? std::min<int64_t>(ub, m.joltage_target[c]) : (int64_t)m.joltage_target[c];
+                any = true;
+            }
+            upper_[v] = ub;  // a button that feeds nothing is never worth pressing
+        }
+        
+        scale_ = 1;
+        for (int64_t p : f.pivot) scale_ = checked_mul(scale_ / std::gcd(scale_, p), p);
+        int64_t base = 0;
+        weight_.assign(nfree, scale_);
+        for (size_t r = 0; r < rank; r++) {
+            int64_t k = scale_ / f.pivot[r];
+            base = checked_add(base, checked_mul(k, residual_[r]));
+            for (size_t v = 0; v < nfree; v++) weight_[v] = checked_sub(weight_[v], checked_mul(k, f.coef(r, v)));
+        }
+        
+        // The search's own arithmetic is unchecked; these sums bound every
+        // value it forms, and throw here if they don't fit
+        int64_t reach = std::abs(base);
+        for (size_t v = 0; v < nfree; v++) reach = checked_add(reach, checked_mul(std::abs(weight_[v]), upper_[v]));
+        for (size_t r = 0; r < rank; r++) {
+            int64_t row_reach = std::abs(residual_[r]);
+            for (size_t v = 0; v < nfree; v++) {
+                row_reach = checked_add(row_reach, checked_mul(std::abs(f.coef(r, v)), upper_[v]));
+            }
+        }
+        
+        best_ = INT64_MAX;
+        nodes_ = 0;
+        search(0, base);
+        if (best_ == INT64_MAX) return std::nullopt;
+        return best_ / scale_;
+    }
+    
+private:
+    const JoltageFactorization* f_ = nullptr;
+    std::vector<int64_t> upper_, weight_, residual_;
+    int64_t scale_ = 1, best_ = INT64_MAX;
+    uint64_t nodes_ = 0;
+    
+    void search(size_t t, int64_t objective) {
+        if ((++nodes_ & 4095) == 0) checkpoint();
+        const JoltageFactorization& f = *f_;
+        const size_t nfree = upper_.size();
+        const size_t rank = residual_.size();
+        
+        if (t == nfree) {
+            for (size_t r = 0; r < rank; r++) {
+                if (residual_[r] < 0 || residual_[r] % f.pivot[r] != 0) return;
+            }
+            best_ = std::min(best_, objective);
+            return;
+        }
+        
+        // Lower bound with the remaining variables at their best box corner
+        int64_t bound = objective;
+        for (size_t g = t; g < nfree; g++) bound += std::min<int64_t>(0, weight_[g] * upper_[g]);
+        if (bound >= best_) return;
+        
+        // Feasible interval for x_t from every row's box relaxation
+        int64_t lo = 0, hi = upper_[t];
+        for (size_t r = 0; r < rank && lo <= hi; r++) {
+            int64_t slack = residual_[r];
+            for (size_t g = t + 1; g < nfree; g++) slack += std::max<int64_t>(0, -f.coef(r, g) * upper_[g]);
+            int64_t a = f.coef(r, t);
+            if (a > 0) {
+                hi = slack < 0 ? -1 : std::min(hi, slack / a);
+            } else if (a < 0) {
+                if (slack < 0) lo = std::max(lo, (-slack + (-a) - 1) / (-a));
+            } else if (slack < 0) {
+                return;
+            }
+        }
+        if (lo > hi) return;
+        
+        // Walk towards the cheaper end first so good incumbents come early
+        const int64_t w = weight_[t];
+        int64_t rest = 0;
+        for (size_t g = t + 1; g < nfree; g++) rest += std::min<int64_t>(0, weight_[g] * upper_[g]);
+        for (int64_t i = 0; i <= hi - lo; i++) {
+            int64_t x = w < 0 ? hi - i : lo + i;
+            int64_t next = objective + w * x;
+            if (next + rest >= best_) {
+                if (w >= 0) break;  // objective only grows from here
+                continue;
+            }
+            for (size_t r = 0; r < rank; r++) residual_[r] -= f.coef(r, t) * x;
+            search(t + 1, next);
+            for (size_t r = 0; r < rank; r++) residual_[r] += f.coef(r, t) * x;
+        }
+    }
+};
+
+// Reentrant part 2 solver. Owns its scratch state, so each thread keeps
+// one and reuses it for every machine it is handed; factorizations come
+// from `cache` when the wiring has been seen before.
+class JoltageSolver {
+public:
+    explicit JoltageSolver(FactorizationCache<JoltageFactorization>* cache = nullptr) : cache_(cache) {}
+    
+    std::optional<int64_t> solve(const Machine& m) {
+        key_ = incidence_key(m, m.num_joltages(), false, order_);
+        auto f = cached_factorization(cache_, key_, [&] { return factorize_integer(m, order_); });
+        return search_.run(*f, m, order_);
+    }
+    
+private:
+    FactorizationCache<JoltageFactorization>* cache_;
+    std::vector<uint64_t> key_;
+    std::vector<size_t> order_;
+    IntegerSearch search_;
+};
+
+// Solve every machine on the thread pool. Machines are handed out one at a
+// time (solve times vary by orders of magnitude, so bigger chunks would
+// leave threads idle), each runner works on its own copy of `prototype`,
+// and results land in a slot per machine so the final sum is
+// deterministic. If any machine throws, the error of the lowest-numbered
+// one is rethrown. A watchdog timeout stops every runner before its next
+// machine and is rethrown instead.
+template <typename Solver, typename Solve>
+std::vector<int64_t> solve_machines(const std::vector<Machine>& machines, const Solver& prototype, Solve solve) {
+    const size_t n = machines.size();
+    std::vector<int64_t> results(n, 0);
+    std::mutex error_mutex;
+    std::exception_ptr error, cancelled;
+    size_t error_index = n;
+    std::atomic<bool> stop{false};
+    progress_total(n);
+    
+    parallel_for_state(n, 1, prototype, [&](Solver& solver, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            if (stop.load(std::memory_order_relaxed)) return;
+            try {
+                results[i] = solve(solver, machines[i], i);
+                progress_advance();
+            } catch (const PartCancelled&) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!cancelled) cancelled = std::current_exception();
+                stop = true;
+                return;
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (i < error_index) {
+                    error_index = i;
+                    error = std::current_exception();
+                }
+            }
+        }
+    });
+    
+    if (cancelled) std::rethrow_exception(cancelled);
+    if (error) std::rethrow_exception(error);
+    return results;
+}
+
+std::vector<Machine> parse_machines(const std::string& input) {
+    std::vector<Machine> machines;
+    for (const auto& line : split(input)) {
+        if (!line.empty()) machines.push_back(parse_machine(line));
+    }
+    return machines;
+}
+
+bool Day10::set_variant(const std::string& name) {
+    if (name == "exact") engine_ = Engine::Exact;
+    else if (name == "uncached") engine_ = Engine::Uncached;
+    else if (name == "reference") engine_ = Engine::Reference;
+    else return false;
+    return true;
+}
+
+Answer Day10::part1(const std::string& input) {
+    std::vector<Machine> machines = parse_machines(input);
     int64_t total = 0;
-    for (const auto& line : lines) {
-        if (line.empty()) continue;
-        int p = solve_part1(parse_machine(line));
+    if (engine_ == Engine::Reference) {
+        progress_total(machines.size());
+        for (const auto& m : machines) {
+            int p = solve_part1(m);
+            if (p != -1) total += p;
+            progress_advance();
+        }
+        return total;
+    }
+    
+    FactorizationCache<LightFactorization> cache;
+    LightSolver prototype(engine_ == Engine::Exact ? &cache : nullptr);
+    auto presses = solve_machines(machines, prototype, [](LightSolver& solver, const Machine& m, size_t) {
+        return solver.solve(m);
+    });
+    if (engine_ == Engine::Exact) cache.report("part 1");
+    for (int64_t p : presses) {
         if (p != -1) total += p;
     }
-    return std::to_string(total);
+    return total;
 }
 
-std::string Day10::part2(const std::string& input) {
-    auto lines = split(input);
+Answer Day10::part2(const std::string& input) {
+    std::vector<Machine> machines = parse_machines(input);
     int64_t total = 0;
-    for (const auto& line : lines) {
-        if (line.empty()) continue;
-        Machine m = parse_machine(line);
-        total += solve_part2_machine(m);
+    if (engine_ == Engine::Reference) {
+        progress_total(machines.size());
+        for (const auto& m : machines) {
+            total += solve_part2_machine(m);
+            progress_advance();
+        }
+        return total;
     }
-    return std::to_string(total);
+    
+    FactorizationCache<JoltageFactorization> cache;
+    JoltageSolver prototype(engine_ == Engine::Exact ? &cache : nullptr);
+    auto presses = solve_machines(machines, prototype, [](JoltageSolver& solver, const Machine& m, size_t index) {
+        auto result = solver.solve(m);
+        if (!result) {
+            throw std::runtime_error("Machine " + std::to_string(index + 1) + " cannot reach its joltage targets");
+        }
+        return *result;
+    });
+    if (engine_ == Engine::Exact) cache.report("part 2");
+    for (int64_t p : presses) total += p;
+    return total;
 }
 
-REGISTER_SOLUTION(Day10)
-
 } // namespace aoc::y2025
\ No newline at end of file
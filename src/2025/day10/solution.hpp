@@ -6,11 +6,24 @@ namespace aoc::y2025 {
 
 class Day10 : public Solution {
 public:
-    std::string part1(const std::string& input) override;
-    std::string part2(const std::string& input) override;
+    Answer part1(const std::string& input) override;
+    Answer part2(const std::string& input) override;
     
     int year() const override { return 2025; }
     int day() const override { return 10; }
+    
+    // exact     - packed GF(2) elimination with a Gray-code walk (part 1),
+    //             fraction-free integer elimination + branch and bound (part 2),
+    //             factorizations shared between machines with the same wiring
+    // uncached  - exact, but every machine is factorized from scratch
+    // reference - byte-per-bit GF(2) elimination with full back substitution,
+    //             floating-point elimination with free variables tried 0..199
+    std::vector<std::string> variants() const override { return {"exact", "uncached", "reference"}; }
+    bool set_variant(const std::string& name) override;
+    
+private:
+    enum class Engine { Exact, Uncached, Reference };
+    Engine engine_ = Engine::Exact;
 };
 
 } // namespace aoc::y2025
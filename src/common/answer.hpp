@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace aoc {
+
+// A puzzle answer: a signed or unsigned (up to 128-bit) integer, or text.
+// Integers and text up to INLINE_TEXT characters are stored in place, so
+// returning an Answer does not allocate; only longer text (e.g. a BigUInt
+// with more than 38 digits) falls back to the heap. Formatting is deferred
+// until to_string() or operator<<, outside any timed region.
+class Answer {
+public:
+    static constexpr size_t INLINE_TEXT = 39;
+
+    Answer() : kind_(Kind::Unsigned), unsigned_(0) {}
+
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+                                                      !std::is_same_v<T, char>>>
+    Answer(T value) {
+        if constexpr (std::is_signed_v<T>) {
+            kind_ = Kind::Signed;
+            signed_ = value;  // __int128 wide, so no signed type is truncated
+        } else {
+            kind_ = Kind::Unsigned;
+            unsigned_ = value;
+        }
+    }
+
+    Answer(__int128 value) : kind_(Kind::Signed), signed_(value) {}
+    Answer(unsigned __int128 value) : kind_(Kind::Unsigned), unsigned_(value) {}
+
+    Answer(std::string_view text) {
+        if (text.size() <= INLINE_TEXT) {
+            kind_ = Kind::Text;
+            std::memcpy(text_, text.data(), text.size());
+            text_size_ = uint8_t(text.size());
+        } else {
+            kind_ = Kind::LongText;
+            long_text_ = text;
+        }
+    }
+    Answer(const char* text) : Answer(std::string_view(text)) {}
+    Answer(const std::string& text) : Answer(std::string_view(text)) {}
+
+    std::string to_string() const {
+        switch (kind_) {
+        case Kind::Signed:
+            if (signed_ < 0) return "-" + format_unsigned(-(unsigned __int128)signed_);
+            return format_unsigned((unsigned __int128)signed_);
+        case Kind::Unsigned: return format_unsigned(unsigned_);
+        case Kind::Text: return std::string(text_, text_size_);
+        case Kind::LongText: return long_text_;
+        }
+        return {};
+    }
+
+    // Integers compare by value whatever their signedness, text by its
+    // characters; an integer never equals text, so 7 != "7"
+    bool operator==(const Answer& other) const {
+        if (is_integer() != other.is_integer()) return false;
+        if (!is_integer()) return text() == other.text();
+        if (kind_ == other.kind_) return kind_ == Kind::Signed ? signed_ == other.signed_ : unsigned_ == other.unsigned_;
+        const Answer& s = kind_ == Kind::Signed ? *this : other;
+        const Answer& u = kind_ == Kind::Signed ? other : *this;
+        return s.signed_ >= 0 && (unsigned __int128)s.signed_ == u.unsigned_;
+    }
+    bool operator!=(const Answer& other) const { return !(*this == other); }
+
+    friend std::ostream& operator<<(std::ostream& out, const Answer& answer) {
+        return out << answer.to_string();
+    }
+
+private:
+    enum class Kind : uint8_t { Signed, Unsigned, Text, LongText };
+
+    Kind kind_;
+    uint8_t text_size_ = 0;
+    union {
+        __int128 signed_;
+        unsigned __int128 unsigned_;
+        char text_[INLINE_TEXT];
+    };
+    std::string long_text_;  // empty (no allocation) unless kind_ == LongText
+
+    bool is_integer() const { return kind_ == Kind::Signed || kind_ == Kind::Unsigned; }
+    std::string_view text() const {
+        return kind_ == Kind::Text ? std::string_view(text_, text_size_) : std::string_view(long_text_);
+    }
+
+    static std::string format_unsigned(unsigned __int128 value) {
+        char digits[40];
+        size_t pos = sizeof(digits);
+        do {
+            digits[--pos] = char('0' + int(value % 10));
+            value /= 10;
+        } while (value > 0);
+        return std::string(digits + pos, sizeof(digits) - pos);
+    }
+};
+
+// Keeps `value` (and the work that produced it) from being optimised away
+template <typename T>
+inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+} // namespace aoc
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace aoc {
+
+// Format an unsigned 128-bit integer (std::to_string has no overload for it)
+inline std::string to_string_u128(unsigned __int128 value) {
+    if (value == 0) return "0";
+    std::string digits;
+    while (value > 0) {
+        digits.push_back(char('0' + int(value % 10)));
+        value /= 10;
+    }
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+// Minimal arbitrary-precision unsigned integer.
+// Only supports what counting problems need: construction from a small
+// value, addition and decimal formatting. Limbs are base 2^32, little-endian.
+class BigUInt {
+public:
+    BigUInt() = default;
+    BigUInt(uint64_t value) {
+        while (value > 0) {
+            limbs_.push_back(uint32_t(value));
+            value >>= 32;
+        }
+    }
+
+    bool is_zero() const { return limbs_.empty(); }
+    bool operator==(const BigUInt& other) const { return limbs_ == other.limbs_; }
+    size_t limb_count() const { return limbs_.size(); }
+
+    BigUInt& operator+=(const BigUInt& other) {
+        if (other.limbs_.size() > limbs_.size()) {
+            limbs_.resize(other.limbs_.size(), 0);
+        }
+        uint64_t carry = 0;
+        size_t i = 0;
+        for (; i < other.limbs_.size(); ++i) {
+            uint64_t sum = uint64_t(limbs_[i]) + other.limbs_[i] + carry;
+            limbs_[i] = uint32_t(sum);
+            carry = sum >> 32;
+        }
+        for (; carry && i < limbs_.size(); ++i) {
+            uint64_t sum = uint64_t(limbs_[i]) + carry;
+            limbs_[i] = uint32_t(sum);
+            carry = sum >> 32;
+        }
+        if (carry) limbs_.push_back(uint32_t(carry));
+        return *this;
+    }
+
+    std::string to_string() const {
+        if (limbs_.empty()) return "0";
+        // Repeatedly divide by 10^9 and collect the remainders
+        std::vector<uint32_t> work = limbs_;
+        std::vector<uint32_t> chunks;
+        while (!work.empty()) {
+            uint64_t rem = 0;
+            for (size_t i = work.size(); i-- > 0;) {
+                uint64_t cur = (rem << 32) | work[i];
+                work[i] = uint32_t(cur / 1000000000u);
+                rem = cur % 1000000000u;
+            }
+            chunks.push_back(uint32_t(rem));
+            while (!work.empty() && work.back() == 0) work.pop_back();
+        }
+        std::string result = std::to_string(chunks.back());
+        for (size_t i = chunks.size() - 1; i-- > 0;) {
+            std::string part = std::to_string(chunks[i]);
+            result.append(9 - part.size(), '0');
+            result += part;
+        }
+        return result;
+    }
+
+private:
+    std::vector<uint32_t> limbs_;
+};
+
+} // namespace aoc
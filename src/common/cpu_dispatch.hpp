@@ -0,0 +1,112 @@
+#pragma once
+
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// Runtime selection between kernels compiled for different instruction
+// sets. The build targets the baseline ISA; kernels that want more are
+// compiled per target with the AOC_TARGET_* attributes and registered in
+// an IsaKernels table, which picks the best one the CPU (or the --isa
+// override) allows.
+//
+//   AOC_TARGET_AVX2 uint64_t sum_avx2(const uint32_t* p, size_t n) { ... }
+//   static const IsaKernels<SumFn> sum_kernels{sum_scalar, nullptr, AOC_IF_X86(sum_avx2)};
+//   SumFn sum = sum_kernels.select();
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AOC_X86 1
+#define AOC_TARGET_SSE42 __attribute__((target("sse4.2")))
+#define AOC_TARGET_AVX2 __attribute__((target("avx2")))
+#define AOC_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl")))
+#define AOC_IF_X86(kernel) kernel
+#else
+#define AOC_IF_X86(kernel) nullptr
+#endif
+
+namespace aoc {
+
+// Ordered: each level implies the ones below it
+enum class Isa { Scalar, Sse42, Avx2, Avx512 };
+
+inline const char* isa_name(Isa isa) {
+    switch (isa) {
+    case Isa::Scalar: return "scalar";
+    case Isa::Sse42: return "sse4.2";
+    case Isa::Avx2: return "avx2";
+    case Isa::Avx512: return "avx512";
+    }
+    return "?";
+}
+
+inline std::optional<Isa> parse_isa(const std::string& name) {
+    for (Isa isa : {Isa::Scalar, Isa::Sse42, Isa::Avx2, Isa::Avx512}) {
+        if (name == isa_name(isa)) return isa;
+    }
+    return std::nullopt;
+}
+
+// Best instruction set the CPU supports (cpuid, queried once)
+inline Isa detected_isa() {
+    static const Isa detected = [] {
+#ifdef AOC_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+            __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl")) {
+            return Isa::Avx512;
+        }
+        if (__builtin_cpu_supports("avx2")) return Isa::Avx2;
+        if (__builtin_cpu_supports("sse4.2")) return Isa::Sse42;
+#endif
+        return Isa::Scalar;
+    }();
+    return detected;
+}
+
+inline std::optional<Isa>& isa_override() {
+    static std::optional<Isa> isa;
+    return isa;
+}
+
+// Cap kernel selection at `isa` (for comparing kernels). Throws if the
+// CPU can't run it.
+inline void set_isa_override(Isa isa) {
+    if (isa > detected_isa()) {
+        throw std::runtime_error(std::string("This CPU does not support ") + isa_name(isa) +
+                                 " (best: " + isa_name(detected_isa()) + ")");
+    }
+    isa_override() = isa;
+}
+
+// The instruction set kernels are selected for
+inline Isa active_isa() {
+    return isa_override().value_or(detected_isa());
+}
+
+// One kernel per instruction set; missing ones are nullptr. The scalar
+// kernel is required and is the fallback for everything else.
+template <typename Fn>
+struct IsaKernels {
+    Fn scalar = nullptr;
+    Fn sse42 = nullptr;
+    Fn avx2 = nullptr;
+    Fn avx512 = nullptr;
+
+    // Best available kernel at or below active_isa(), and which ISA it is for
+    Fn select(Isa* chosen = nullptr) const {
+        const Isa limit = active_isa();
+        const std::pair<Isa, Fn> options[] = {
+            {Isa::Avx512, avx512}, {Isa::Avx2, avx2}, {Isa::Sse42, sse42}};
+        for (const auto& [isa, fn] : options) {
+            if (fn && isa <= limit) {
+                if (chosen) *chosen = isa;
+                return fn;
+            }
+        }
+        if (chosen) *chosen = Isa::Scalar;
+        return scalar;
+    }
+};
+
+} // namespace aoc
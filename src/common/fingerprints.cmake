@@ -0,0 +1,48 @@
+# Writes the build fingerprint table (Registry::fingerprint) to OUTPUT.
+#
+#   DAYS     year/dayNN of every solution, in registry order
+#   OBJECTS  object files of the solutions
+#   COMMON   the aoc_common library, which every day also runs
+#
+# A day's fingerprint is a SHA-256 over its object files and COMMON, cut to
+# 16 hex digits. Run by the build after compiling; see CMakeLists.txt.
+
+file(SHA256 "${COMMON}" common_hash)
+
+set(rows "")
+foreach(day ${DAYS})
+    set(hashes "${common_hash}")
+    set(found FALSE)
+    foreach(object ${OBJECTS})
+        if(object MATCHES "/${day}/")
+            file(SHA256 "${object}" object_hash)
+            string(APPEND hashes "${object_hash}")
+            set(found TRUE)
+        endif()
+    endforeach()
+    if(NOT found)
+        message(FATAL_ERROR "No object file for ${day}")
+    endif()
+    string(SHA256 fingerprint "${hashes}")
+    string(SUBSTRING "${fingerprint}" 0 16 fingerprint)
+    string(APPEND rows "    \"${fingerprint}\",  // ${day}\n")
+endforeach()
+
+file(WRITE "${OUTPUT}" "// Generated by src/common/fingerprints.cmake; do not edit.
+#include \"common/registry.hpp\"
+
+namespace aoc {
+
+namespace {
+
+const char* const fingerprints[] = {
+${rows}};
+
+} // namespace
+
+const char* Registry::fingerprint(const SolutionEntry& entry) {
+    return fingerprints[&entry - begin()];
+}
+
+} // namespace aoc
+")
@@ -0,0 +1,475 @@
+#include "harness.hpp"
+#include "memory.hpp"
+#include "watchdog.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace aoc {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::string read_sysfs(const std::string& path) {
+    std::ifstream file(path);
+    std::string value;
+    std::getline(file, value);
+    return value;
+}
+
+// Size of the largest CPU cache, from sysfs ("32768K"), 32 MiB if unknown
+size_t largest_cache_bytes() {
+    size_t largest = 0;
+    for (int index = 0; index < 8; index++) {
+        std::string size = read_sysfs("/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/size");
+        if (size.empty()) break;
+        size_t bytes = std::strtoull(size.c_str(), nullptr, 10);
+        if (size.back() == 'K') bytes <<= 10;
+        if (size.back() == 'M') bytes <<= 20;
+        largest = std::max(largest, bytes);
+    }
+    return largest ? largest : size_t(32) << 20;
+}
+
+// Evict the caches by streaming writes and reads through a buffer twice
+// the size of the last-level cache. The buffer comes from calloc, not
+// operator new, so it stays out of the heap counters and --mem-limit.
+void flush_caches() {
+    static const size_t words = std::max<size_t>(largest_cache_bytes() * 2, 8 << 20) / sizeof(uint64_t);
+    static uint64_t* const buffer = static_cast<uint64_t*>(std::calloc(words, sizeof(uint64_t)));
+    if (!buffer) return;
+    static uint64_t round = 0;
+    round++;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < words; i += 8) {  // one write per 64-byte line
+        buffer[i] += round;
+        sum += buffer[i];
+    }
+    do_not_optimize(sum);
+}
+
+// Memory used by one call
+struct CallMemory {
+    size_t peak_rss = 0;   // RSS high-water mark above the RSS before the call
+    size_t peak_heap = 0;  // live heap high-water mark above the live heap before
+    uint64_t allocated = 0;
+    uint64_t allocations = 0;
+};
+
+struct PartTiming {
+    Answer answer;
+    std::string timed_out;  // PartCancelled message of the call that overran
+    double cold_us = 0;
+    CallMemory memory;  // of the cold call
+    std::vector<double> runs_us;  // warm iterations, sorted
+
+    double mean() const {
+        double total = 0;
+        for (double us : runs_us) total += us;
+        return runs_us.empty() ? 0 : total / runs_us.size();
+    }
+    double min() const { return runs_us.empty() ? 0 : runs_us.front(); }
+    double median() const { return runs_us.empty() ? 0 : runs_us[runs_us.size() / 2]; }
+};
+
+// Brackets a part call for the watchdog, also when the part throws
+class WatchedCall {
+public:
+    explicit WatchedCall(int part) { begin_call(part); }
+    ~WatchedCall() { end_call(); }
+    WatchedCall(const WatchedCall&) = delete;
+    WatchedCall& operator=(const WatchedCall&) = delete;
+};
+
+// Time one call of part `number` (1 or 2); throws PartCancelled if the
+// watchdog stops it
+template <typename Part>
+double time_call(int number, Part part, Answer& answer) {
+    WatchedCall watched(number);
+    auto start = Clock::now();
+    answer = part();
+    do_not_optimize(answer);
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+// time_call that also records the call's memory use; the accounting
+// happens outside the timed region
+template <typename Part>
+double measured_call(int number, Part part, Answer& answer, CallMemory& memory) {
+    reset_peak_rss();
+    reset_heap_peak();
+    const size_t rss_before = current_rss_bytes();
+    const HeapStats heap_before = heap_stats();
+    const double us = time_call(number, part, answer);
+    const HeapStats heap_after = heap_stats();
+    memory.peak_rss = std::max(peak_rss_bytes(), rss_before) - rss_before;
+    memory.peak_heap = std::max(heap_after.peak_live_bytes, heap_before.live_bytes) - heap_before.live_bytes;
+    memory.allocated = heap_after.allocated_bytes - heap_before.allocated_bytes;
+    memory.allocations = heap_after.allocations - heap_before.allocations;
+    return us;
+}
+
+// "VmHWM:   123456 kB" -> bytes
+size_t read_status_kb(const char* field) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    const size_t len = std::strlen(field);
+    while (std::getline(status, line)) {
+        if (line.compare(0, len, field) == 0 && line.size() > len && line[len] == ':') {
+            return size_t(std::strtoull(line.c_str() + len + 1, nullptr, 10)) << 10;
+        }
+    }
+    return 0;
+}
+
+std::string format_duration(double us) {
+    char buf[32];
+    if (us >= 1e6) std::snprintf(buf, sizeof(buf), "%.2f s", us / 1e6);
+    else if (us >= 1e3) std::snprintf(buf, sizeof(buf), "%.2f ms", us / 1e3);
+    else std::snprintf(buf, sizeof(buf), "%.1f µs", us);
+    return buf;
+}
+
+// Least-squares slope of log(y) against log(x); NaN with fewer than 3 points
+double loglog_slope(const std::vector<std::pair<double, double>>& points) {
+    if (points.size() < 3) return NAN;
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (auto [x, y] : points) {
+        const double lx = std::log(x), ly = std::log(y);
+        sx += lx;
+        sy += ly;
+        sxx += lx * lx;
+        sxy += lx * ly;
+    }
+    const double k = double(points.size());
+    const double var = sxx - sx * sx / k;
+    return var > 0 ? (sxy - sx * sy / k) / var : NAN;
+}
+
+// Timings below this are dominated by noise and fixed costs
+constexpr double FIT_MIN_US = 50;
+constexpr size_t FIT_MIN_BYTES = 64 << 10;
+
+struct ScalePoint {
+    size_t n = 0;
+    size_t bytes = 0;
+    double us[2] = {0, 0};
+    CallMemory memory[2];
+    std::string error[2];
+};
+
+} // namespace
+
+RunResult run_benchmark(Solution& solution, const std::string& input, const BenchOptions& options) {
+    Metrics::instance().clear();
+
+    auto part1 = [&] { return solution.part1(input); };
+    auto part2 = [&] { return solution.part2(input); };
+    PartTiming timings[2];
+
+    // Cold start: the first call of each part, with nothing in the caches.
+    // A part that times out here is not run again.
+    for (int part = 0; part < 2; part++) {
+        PartTiming& timing = timings[part];
+        flush_caches();
+        try {
+            timing.cold_us = part == 0 ? measured_call(1, part1, timing.answer, timing.memory)
+                                       : measured_call(2, part2, timing.answer, timing.memory);
+        } catch (const PartCancelled& e) {
+            timing.timed_out = e.what();
+        }
+    }
+
+    // Steady state, one clock reading per call so flushing stays untimed.
+    // A timeout ends the part's runs; the completed ones are still reported.
+    for (int part = 0; part < 2; part++) {
+        PartTiming& timing = timings[part];
+        for (int i = 0; i < options.iterations && timing.timed_out.empty(); ++i) {
+            if (options.flush_caches) flush_caches();
+            try {
+                timing.runs_us.push_back(part == 0 ? time_call(1, part1, timing.answer)
+                                                   : time_call(2, part2, timing.answer));
+            } catch (const PartCancelled& e) {
+                timing.timed_out = e.what();
+            }
+        }
+        std::sort(timing.runs_us.begin(), timing.runs_us.end());
+    }
+
+    // Answers are only formatted here, outside the timed calls
+    for (int part = 0; part < 2; part++) {
+        const PartTiming& timing = timings[part];
+        std::cout << "Part " << part + 1 << ": ";
+        if (timing.runs_us.empty() && !timing.timed_out.empty()) {
+            std::cout << timing.timed_out << "\n";
+        } else {
+            std::cout << timing.answer << " (" << int64_t(timing.mean()) << " µs)\n";
+        }
+    }
+    RunResult result;
+    const char* steady = options.flush_caches ? "flushed" : "warm";
+    for (int part = 0; part < 2; part++) {
+        const PartTiming& timing = timings[part];
+        if (timing.runs_us.empty() && !timing.timed_out.empty()) continue;
+        char line[160];
+        std::snprintf(line, sizeof(line), "  part %d: cold %.1f µs, %s min %.1f / median %.1f µs", part + 1,
+                      timing.cold_us, steady, timing.min(), timing.median());
+        result.details.push_back(line);
+        if (!timing.timed_out.empty()) {
+            result.details.push_back("  part " + std::to_string(part + 1) + ": stopped after " +
+                                     std::to_string(timing.runs_us.size()) + " of " +
+                                     std::to_string(options.iterations) + " warm runs, " + timing.timed_out);
+        }
+    }
+    for (int part = 0; part < 2; part++) {
+        if (timings[part].runs_us.empty() && !timings[part].timed_out.empty()) continue;
+        const CallMemory& memory = timings[part].memory;
+        result.details.push_back("  part " + std::to_string(part + 1) + " memory: peak RSS +" +
+                                 Metrics::format_bytes(memory.peak_rss) + ", peak heap +" +
+                                 Metrics::format_bytes(memory.peak_heap) + ", " +
+                                 Metrics::format_bytes(memory.allocated) + " in " +
+                                 std::to_string(memory.allocations) + " allocations");
+    }
+    for (const auto& [name, value] : Metrics::instance().snapshot()) {
+        result.details.push_back("  " + name + ": " + value);
+    }
+    for (const std::string& line : result.details) std::cout << line << "\n";
+    for (int part = 0; part < 2; part++) {
+        result.answers[part] = timings[part].answer.to_string();
+        result.us[part] = timings[part].mean();
+        if (!timings[part].timed_out.empty()) result.complete = false;
+    }
+    return result;
+}
+
+RunResult run_parts(Solution& solution, const std::string& input) {
+    RunResult result;
+    for (int part = 1; part <= 2; part++) {
+        Answer answer;
+        try {
+            result.us[part - 1] = time_call(
+                part, [&] { return part == 1 ? solution.part1(input) : solution.part2(input); }, answer);
+        } catch (const PartCancelled& e) {
+            std::cout << "Part " << part << ": " << e.what() << "\n";
+            result.complete = false;
+            continue;
+        }
+        result.answers[part - 1] = answer.to_string();
+        std::cout << "Part " << part << ": " << result.answers[part - 1] << "\n";
+    }
+    return result;
+}
+
+size_t current_rss_bytes() { return read_status_kb("VmRSS"); }
+
+size_t peak_rss_bytes() { return read_status_kb("VmHWM"); }
+
+bool reset_peak_rss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    return bool(clear_refs << "5") && bool(clear_refs.flush());
+}
+
+void run_scaling(Solution& solution, const std::string& input, const ScaleOptions& options) {
+    const size_t full = solution.scale_size(input);
+    std::vector<size_t> sizes;
+    for (int step = options.steps - 1; step >= 0; step--) {
+        const size_t n = size_t(std::llround(full / std::pow(2.0, step)));
+        if (n >= 1 && (sizes.empty() || n > sizes.back())) sizes.push_back(n);
+    }
+    if (!reset_peak_rss()) {
+        std::cerr << "Warning: cannot reset the peak RSS (/proc/self/clear_refs); peak_rss_bytes are process peaks\n";
+    }
+
+    std::vector<ScalePoint> points;
+    size_t timed_out_at[2] = {0, 0};  // a part that timed out skips the larger sizes
+    for (size_t n : sizes) {
+        ScalePoint point;
+        point.n = n;
+        const std::string cut = solution.scale_input(input, n);
+        point.bytes = cut.size();
+        for (int part = 0; part < 2; part++) {
+            if (timed_out_at[part]) {
+                point.error[part] = "skipped (timed out at n = " + std::to_string(timed_out_at[part]) + ")";
+                continue;
+            }
+            auto call = [&] { return part == 0 ? solution.part1(cut) : solution.part2(cut); };
+            try {
+                // Memory from the first call, time from the best of a few
+                Answer answer;
+                double best = measured_call(part + 1, call, answer, point.memory[part]);
+                double total = best;
+                for (int rep = 1; rep < 10 && total < 2e5; rep++) {
+                    const double us = time_call(part + 1, call, answer);
+                    best = std::min(best, us);
+                    total += us;
+                }
+                point.us[part] = best;
+            } catch (const PartCancelled& e) {
+                point.error[part] = e.what();
+                timed_out_at[part] = n;
+            } catch (const std::exception& e) {
+                point.error[part] = e.what();
+            }
+        }
+        points.push_back(point);
+    }
+
+    std::printf("%10s %12s  %12s %12s  %12s %12s\n", "n", "input", "part 1", "heap", "part 2", "heap");
+    for (const ScalePoint& point : points) {
+        std::printf("%10zu %12s", point.n, Metrics::format_bytes(point.bytes).c_str());
+        for (int part = 0; part < 2; part++) {
+            if (point.error[part].empty()) {
+                std::printf("  %12s %12s", format_duration(point.us[part]).c_str(),
+                            Metrics::format_bytes(point.memory[part].peak_heap).c_str());
+            } else {
+                const std::string& error = point.error[part];
+                const char* label = error.rfind("timed out", 0) == 0 ? "timed out"
+                                  : error.rfind("skipped", 0) == 0   ? "skipped"
+                                                                     : "error";
+                std::printf("  %25s", label);
+            }
+        }
+        std::printf("\n");
+    }
+    for (int part = 0; part < 2; part++) {
+        std::vector<std::pair<double, double>> time_points, memory_points;
+        for (const ScalePoint& point : points) {
+            if (!point.error[part].empty()) {
+                std::printf("part %d failed at n = %zu: %s\n", part + 1, point.n, point.error[part].c_str());
+                continue;
+            }
+            if (point.us[part] >= FIT_MIN_US) time_points.emplace_back(point.n, point.us[part]);
+            const size_t heap = point.memory[part].peak_heap;
+            if (heap >= FIT_MIN_BYTES) memory_points.emplace_back(point.n, heap);
+        }
+        auto exponent = [](double k) {
+            char buf[32];
+            if (std::isnan(k)) return std::string("too few large points to fit");
+            std::snprintf(buf, sizeof(buf), "n^%.2f", k);
+            return std::string(buf);
+        };
+        std::printf("part %d: time ~ %s, memory ~ %s\n", part + 1, exponent(loglog_slope(time_points)).c_str(),
+                    exponent(loglog_slope(memory_points)).c_str());
+    }
+
+    if (!options.csv_path.empty()) {
+        std::ofstream csv(options.csv_path);
+        if (!csv) throw std::runtime_error("Cannot write " + options.csv_path);
+        csv << "part,n,input_bytes,time_us,peak_heap_bytes,peak_rss_bytes,allocated_bytes,allocations,error\n";
+        for (int part = 0; part < 2; part++) {
+            for (const ScalePoint& point : points) {
+                csv << part + 1 << ',' << point.n << ',' << point.bytes << ',';
+                if (point.error[part].empty()) {
+                    const CallMemory& memory = point.memory[part];
+                    csv << point.us[part] << ',' << memory.peak_heap << ',' << memory.peak_rss << ','
+                        << memory.allocated << ',' << memory.allocations << ",\n";
+                } else {
+                    std::string error = point.error[part];
+                    std::replace(error.begin(), error.end(), ',', ';');
+                    csv << ",,,,," << error << "\n";
+                }
+            }
+        }
+        std::cout << "Wrote " << options.csv_path << "\n";
+    }
+}
+
+std::optional<std::vector<int>> parse_cpu_list(const std::string& list) {
+    std::vector<int> cpus;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t end = list.find(',', pos);
+        if (end == std::string::npos) end = list.size();
+        const std::string item = list.substr(pos, end - pos);
+        const size_t dash = item.find('-');
+        try {
+            size_t used = 0;
+            int first = std::stoi(item, &used);
+            int last = first;
+            if (dash != std::string::npos) {
+                if (used != dash) return std::nullopt;
+                last = std::stoi(item.substr(dash + 1), &used);
+                if (used != item.size() - dash - 1) return std::nullopt;
+            } else if (used != item.size()) {
+                return std::nullopt;
+            }
+            if (first < 0 || last < first) return std::nullopt;
+            for (int cpu = first; cpu <= last; cpu++) cpus.push_back(cpu);
+        } catch (const std::exception&) {
+            return std::nullopt;
+        }
+        pos = end + 1;
+    }
+    if (cpus.empty()) return std::nullopt;
+    return cpus;
+}
+
+void pin_process(const std::vector<int>& cpus) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        if (cpu >= CPU_SETSIZE) throw std::runtime_error("CPU " + std::to_string(cpu) + " is out of range");
+        CPU_SET(cpu, &set);
+    }
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        throw std::runtime_error("Cannot pin to the requested CPUs (are they online and allowed?)");
+    }
+#else
+    (void)cpus;
+    throw std::runtime_error("CPU pinning is only supported on Linux");
+#endif
+}
+
+std::vector<int> allowed_cpus() {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        for (unsigned cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); cpu++) cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+void warn_noisy_environment() {
+    for (int cpu : allowed_cpus()) {
+        const std::string cpufreq = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/";
+        const std::string governor = read_sysfs(cpufreq + "scaling_governor");
+        if (!governor.empty() && governor != "performance") {
+            std::cerr << "Warning: CPU " << cpu << " uses the '" << governor
+                      << "' frequency governor; timings vary with clock speed (use 'performance')\n";
+            break;
+        }
+    }
+    if (read_sysfs("/sys/devices/system/cpu/intel_pstate/no_turbo") == "0" ||
+        read_sysfs("/sys/devices/system/cpu/cpufreq/boost") == "1") {
+        std::cerr << "Warning: turbo boost is enabled; clock speed depends on temperature and load\n";
+    }
+    // A 1-minute load average above one means something else wants a core
+    double load = 0;
+    std::ifstream loadavg("/proc/loadavg");
+    if (loadavg >> load && load >= 1.0) {
+        char value[32];
+        std::snprintf(value, sizeof(value), "%.2f", load);
+        std::cerr << "Warning: load average is " << value << "; other processes may disturb timings\n";
+    }
+}
+
+} // namespace aoc
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+#include "solution.hpp"
+
+namespace aoc {
+
+// What a run produced, for the result cache (result_cache.hpp)
+struct RunResult {
+    std::string answers[2];
+    double us[2] = {0, 0};  // the call, or the warm mean under --bench
+    bool complete = true;   // false if a part timed out
+    std::vector<std::string> details;  // --bench: the timing, memory and metrics lines
+};
+
+// Print both answers. A part stopped by the watchdog (see watchdog.hpp)
+// prints "Part N: timed out after ..." with its progress instead.
+RunResult run_parts(Solution& solution, const std::string& input);
+
+// How `aoc --bench` measures a solution
+struct BenchOptions {
+    int iterations = 100;
+    bool flush_caches = false;  // evict the CPU caches before every timed call
+};
+
+// Run both parts under the benchmark harness and print answers, timings,
+// memory use and metrics. Each part is measured twice: once cold (the
+// first call, after evicting the caches; its peak RSS and heap growth and
+// bytes allocated are reported too) and then `iterations` times warm.
+// A part that times out cold is reported as such; one that times out
+// during the warm runs reports the runs it completed.
+RunResult run_benchmark(Solution& solution, const std::string& input, const BenchOptions& options);
+
+// How `aoc --scale` sweeps input sizes
+struct ScaleOptions {
+    int steps = 8;          // sizes n, n/2, ..., n/2^(steps-1) of the full input
+    std::string csv_path;   // also write the measurements here as CSV
+};
+
+// Run both parts on a geometric series of cut-down inputs (see
+// Solution::scale_input), print time and peak heap against n, and fit
+// the exponent k of time ~ n^k and memory ~ n^k by least squares on the
+// log-log points
+void run_scaling(Solution& solution, const std::string& input, const ScaleOptions& options);
+
+// Resident set size of the process and its high-water mark (VmRSS/VmHWM)
+size_t current_rss_bytes();
+size_t peak_rss_bytes();
+
+// Reset the high-water mark to the current RSS via /proc/self/clear_refs.
+// False where the kernel doesn't support it; peak_rss_bytes() then keeps
+// reporting the peak of the whole process.
+bool reset_peak_rss();
+
+// Parse a CPU list such as "3", "0-3" or "0,2,4-5"
+std::optional<std::vector<int>> parse_cpu_list(const std::string& list);
+
+// Restrict the process (and every thread it starts later) to `cpus`.
+// Throws std::runtime_error if the kernel refuses.
+void pin_process(const std::vector<int>& cpus);
+
+// CPUs the process may currently run on
+std::vector<int> allowed_cpus();
+
+// Print warnings to stderr about things that make timings noisy:
+// frequency scaling governors, turbo boost, and a busy machine
+void warn_noisy_environment();
+
+} // namespace aoc
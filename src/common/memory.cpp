@@ -0,0 +1,131 @@
+#include "memory.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <malloc.h>
+
+namespace aoc {
+
+namespace {
+
+std::atomic<uint64_t> allocated_bytes{0};
+std::atomic<uint64_t> allocations{0};
+std::atomic<size_t> live_bytes{0};
+std::atomic<size_t> peak_live_bytes{0};
+std::atomic<size_t> memory_limit{0};
+
+void* allocate(size_t size, size_t alignment, bool nothrow) {
+    if (size == 0) size = 1;
+    const size_t limit = memory_limit.load(std::memory_order_relaxed);
+    if (limit && live_bytes.load(std::memory_order_relaxed) + size > limit) {
+        if (nothrow) return nullptr;
+        throw MemoryLimitExceeded(limit, size);
+    }
+
+    void* ptr = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+        ptr = std::malloc(size);
+    } else if (posix_memalign(&ptr, alignment, size) != 0) {
+        ptr = nullptr;
+    }
+    if (!ptr) {
+        if (nothrow) return nullptr;
+        throw std::bad_alloc();
+    }
+
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    const size_t usable = malloc_usable_size(ptr);
+    const size_t live = live_bytes.fetch_add(usable, std::memory_order_relaxed) + usable;
+    size_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+    return ptr;
+}
+
+void deallocate(void* ptr) {
+    if (!ptr) return;
+    live_bytes.fetch_sub(malloc_usable_size(ptr), std::memory_order_relaxed);
+    std::free(ptr);
+}
+
+// Like Metrics::format_bytes, without allocating (the heap may be full)
+void format_bytes(char* buf, size_t size, size_t bytes) {
+    const char* units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+    double value = bytes;
+    int unit = 0;
+    while (value >= 1024 && unit < 4) {
+        value /= 1024;
+        unit++;
+    }
+    std::snprintf(buf, size, unit == 0 ? "%.0f %s" : "%.1f %s", value, units[unit]);
+}
+
+} // namespace
+
+HeapStats heap_stats() {
+    HeapStats stats;
+    stats.allocated_bytes = allocated_bytes.load(std::memory_order_relaxed);
+    stats.allocations = allocations.load(std::memory_order_relaxed);
+    stats.live_bytes = live_bytes.load(std::memory_order_relaxed);
+    stats.peak_live_bytes = peak_live_bytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void reset_heap_peak() {
+    peak_live_bytes.store(live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void set_memory_limit(size_t bytes) {
+    memory_limit.store(bytes, std::memory_order_relaxed);
+}
+
+MemoryLimitExceeded::MemoryLimitExceeded(size_t limit, size_t requested) {
+    char limit_text[32], requested_text[32];
+    format_bytes(limit_text, sizeof(limit_text), limit);
+    format_bytes(requested_text, sizeof(requested_text), requested);
+    std::snprintf(message_, sizeof(message_), "Memory limit of %s exceeded (allocating %s more)", limit_text,
+                  requested_text);
+}
+
+std::optional<size_t> parse_byte_size(const std::string& text) {
+    if (text.empty()) return std::nullopt;
+    char* end = nullptr;
+    const double value = std::strtod(text.c_str(), &end);
+    if (end == text.c_str() || value < 0) return std::nullopt;
+    const std::string unit = end;
+    double scale = 1;
+    if (unit == "K" || unit == "KiB") scale = 1 << 10;
+    else if (unit == "M" || unit == "MiB") scale = 1 << 20;
+    else if (unit == "G" || unit == "GiB") scale = 1 << 30;
+    else if (!unit.empty() && unit != "B") return std::nullopt;
+    return size_t(value * scale);
+}
+
+} // namespace aoc
+
+// Replacement global allocation functions
+
+void* operator new(size_t size) { return aoc::allocate(size, 0, false); }
+void* operator new[](size_t size) { return aoc::allocate(size, 0, false); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return aoc::allocate(size, 0, true); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return aoc::allocate(size, 0, true); }
+void* operator new(size_t size, std::align_val_t align) { return aoc::allocate(size, size_t(align), false); }
+void* operator new[](size_t size, std::align_val_t align) { return aoc::allocate(size, size_t(align), false); }
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return aoc::allocate(size, size_t(align), true);
+}
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return aoc::allocate(size, size_t(align), true);
+}
+
+void operator delete(void* ptr) noexcept { aoc::deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { aoc::deallocate(ptr); }
+void operator delete(void* ptr, size_t) noexcept { aoc::deallocate(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { aoc::deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { aoc::deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { aoc::deallocate(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { aoc::deallocate(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { aoc::deallocate(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { aoc::deallocate(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { aoc::deallocate(ptr); }
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <string>
+
+namespace aoc {
+
+// Heap accounting. Linking memory.cpp replaces the global operator
+// new/delete with versions that count every allocation (malloc'd blocks
+// outside operator new are not seen).
+struct HeapStats {
+    uint64_t allocated_bytes = 0;  // total requested since start
+    uint64_t allocations = 0;
+    size_t live_bytes = 0;         // usable size of the blocks still held
+    size_t peak_live_bytes = 0;    // high-water mark of live_bytes
+};
+
+HeapStats heap_stats();
+
+// Start a new high-water mark from the current live size
+void reset_heap_peak();
+
+// Make operator new throw MemoryLimitExceeded once live heap would pass
+// `bytes`; 0 removes the limit
+void set_memory_limit(size_t bytes);
+
+class MemoryLimitExceeded : public std::bad_alloc {
+public:
+    MemoryLimitExceeded(size_t limit, size_t requested);
+    const char* what() const noexcept override { return message_; }
+
+private:
+    char message_[128];
+};
+
+// "512M", "2G", "1500K" or plain bytes
+std::optional<size_t> parse_byte_size(const std::string& text);
+
+} // namespace aoc
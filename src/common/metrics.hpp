@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+
+// Named values a solution reports about its work (memory footprints, cache
+// hit rates, ...). Printed below the timings in benchmark mode.
+class Metrics {
+public:
+    static inline Metrics& instance() {
+        static Metrics metrics;
+        return metrics;
+    }
+
+    inline void set(const std::string& name, const std::string& value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        values_[name] = value;
+    }
+
+    inline void set_bytes(const std::string& name, uint64_t bytes) {
+        set(name, format_bytes(bytes));
+    }
+
+    inline std::vector<std::pair<std::string, std::string>> snapshot() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return {values_.begin(), values_.end()};
+    }
+
+    inline void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        values_.clear();
+    }
+
+    static inline std::string format_bytes(uint64_t bytes) {
+        const char* units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+        double value = bytes;
+        int unit = 0;
+        while (value >= 1024 && unit < 4) {
+            value /= 1024;
+            unit++;
+        }
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), unit == 0 ? "%.0f %s" : "%.1f %s", value, units[unit]);
+        return buf;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::map<std::string, std::string> values_;
+};
+
+} // namespace aoc
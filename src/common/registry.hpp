@@ -2,51 +2,63 @@
 #pragma once
 
 #include "solution.hpp"
-#include <map>
+#include <cstddef>
 #include <memory>
-#include <functional>
 
 namespace aoc {
 
+using SolutionFactory = std::unique_ptr<Solution> (*)();
+
+struct SolutionEntry {
+    int year;
+    int day;
+    int parts;  // 1 on day 25, which has no second puzzle
+    SolutionFactory create;
+};
+
+// One puzzle of a solution, for batch runs over every part
+struct SolutionPart {
+    const SolutionEntry* entry;
+    int part;
+};
+
+// Every solution under src/<year>/day<NN>/, ordered by (year, day).
+// The table is generated by CMake (registry_table.cpp.in), so there is no
+// registration at static-initialization time.
 class Registry {
 public:
-    using Factory = std::function<std::unique_ptr<Solution>()>;
-    
-    static inline Registry& instance() {
-        static Registry reg;
-        return reg;
-    }
-    
-    inline void add(int year, int day, Factory factory) {
-        solutions_[{year, day}] = std::move(factory);
-    }
-    
-    inline std::unique_ptr<Solution> get(int year, int day) {
-        auto it = solutions_.find({year, day});
-        if (it == solutions_.end()) return nullptr;
-        return it->second();
+    static const SolutionEntry* begin();
+    static const SolutionEntry* end();
+    static size_t size() { return size_t(end() - begin()); }
+
+    // Table entry for (year, day) or nullptr; a dense array lookup
+    static const SolutionEntry* find(int year, int day);
+
+    // Hash of the entry's compiled code and of aoc_common, 16 hex digits.
+    // Generated after compiling (fingerprints.cmake), so it changes with
+    // the day's code, the headers it uses and the compiler flags.
+    static const char* fingerprint(const SolutionEntry& entry);
+
+    static std::unique_ptr<Solution> create(int year, int day) {
+        const SolutionEntry* entry = find(year, day);
+        return entry ? entry->create() : nullptr;
     }
-    
-    inline std::vector<std::pair<int, int>> list() const {
-        std::vector<std::pair<int, int>> result;
-        for (const auto& [key, _] : solutions_) {
-            result.push_back(key);
+
+    // Call fn(SolutionPart) for every part of every solution, in order
+    template <typename F>
+    static void for_each_part(F fn) {
+        for (const SolutionEntry* entry = begin(); entry != end(); ++entry) {
+            for (int part = 1; part <= entry->parts; part++) fn(SolutionPart{entry, part});
         }
-        return result;
     }
-    
-private:
-    std::map<std::pair<int, int>, Factory> solutions_;
 };
 
-#define REGISTER_SOLUTION(cls) \
-    namespace { \
-        static bool cls##_registered = []() { \
-            aoc::Registry::instance().add( \
-                cls().year(), cls().day(), \
-                []() { return std::make_unique<cls>(); }); \
-            return true; \
-        }(); \
-    }
+// Registry wrapper so range-for works: for (const auto& e : solutions())
+struct SolutionRange {
+    const SolutionEntry* begin() const { return Registry::begin(); }
+    const SolutionEntry* end() const { return Registry::end(); }
+};
+
+inline SolutionRange solutions() { return {}; }
 
-} // namespace aoc
\ No newline at end of file
+} // namespace aoc
@@ -0,0 +1,141 @@
+#include "result_cache.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <unistd.h>
+
+namespace aoc {
+
+namespace {
+
+// FNV-1a; the key only has to tell inputs apart, not resist collisions
+uint64_t hash_bytes(const std::string& bytes) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char c : bytes) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Answers may span lines (letters drawn in ASCII art)
+std::string escape(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '\\') out += "\\\\";
+        else if (c == '\n') out += "\\n";
+        else out += c;
+    }
+    return out;
+}
+
+std::string unescape(const std::string& text) {
+    std::string out;
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '\\' && i + 1 < text.size()) {
+            out += text[++i] == 'n' ? '\n' : text[i];
+        } else {
+            out += text[i];
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+const CachedRun* CacheEntry::latest(const std::string& mode) const {
+    for (auto run = history.rbegin(); run != history.rend(); ++run) {
+        if (run->mode == mode) return &*run;
+    }
+    return nullptr;
+}
+
+ResultCache::ResultCache(std::string directory) : directory_(std::move(directory)) {}
+
+std::string ResultCache::default_directory() {
+    const char* env = std::getenv("AOC_CACHE_DIR");
+    return env && *env ? env : AOC_CACHE_DIR;
+}
+
+std::string ResultCache::key(const std::string& input, const char* fingerprint, const std::string& variant) {
+    char hash[17];
+    std::snprintf(hash, sizeof(hash), "%016llx", (unsigned long long)hash_bytes(input));
+    std::string key = std::string(hash) + "-" + fingerprint;
+    if (!variant.empty()) key += "-" + variant;
+    return key;
+}
+
+std::string ResultCache::path(int year, int day, const std::string& key) const {
+    char dir[32];
+    std::snprintf(dir, sizeof(dir), "/%d/day%02d/", year, day);
+    return directory_ + dir + key;
+}
+
+std::optional<CacheEntry> ResultCache::load(int year, int day, const std::string& key) const {
+    std::ifstream file(path(year, day, key));
+    if (!file) return std::nullopt;
+
+    CacheEntry entry;
+    bool answered[2] = {false, false};
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.rfind("answer ", 0) == 0 && line.size() >= 9 && (line[7] == '1' || line[7] == '2')) {
+            const int part = line[7] - '1';
+            entry.answers[part] = unescape(line.substr(9));
+            answered[part] = true;
+        } else if (line.rfind("run ", 0) == 0) {
+            std::istringstream fields(line.substr(4));
+            CachedRun run;
+            if (fields >> run.when >> run.mode >> run.us[0] >> run.us[1]) entry.history.push_back(run);
+        } else if (line.rfind("detail ", 0) == 0 && !entry.history.empty()) {
+            entry.history.back().details.push_back(unescape(line.substr(7)));
+        }
+    }
+    if (!answered[0] || !answered[1]) return std::nullopt;
+    return entry;
+}
+
+bool ResultCache::record(int year, int day, const std::string& key, const RunResult& result,
+                         const std::string& mode) const {
+    if (!result.complete) return true;  // nothing trustworthy to store
+
+    CacheEntry entry = load(year, day, key).value_or(CacheEntry{});
+    for (int part = 0; part < 2; part++) entry.answers[part] = result.answers[part];
+    CachedRun run;
+    run.when = int64_t(std::time(nullptr));
+    run.mode = mode;
+    run.us[0] = result.us[0];
+    run.us[1] = result.us[1];
+    run.details = result.details;
+    entry.history.push_back(run);
+
+    // Write a temporary file and rename it over the entry, so concurrent
+    // runs never see half an entry
+    const std::string target = path(year, day, key);
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(target).parent_path(), error);
+    const std::string temporary = target + ".tmp" + std::to_string(getpid());
+    {
+        std::ofstream file(temporary);
+        if (!file) return false;
+        file << std::fixed << std::setprecision(1);
+        for (int part = 0; part < 2; part++) {
+            file << "answer " << part + 1 << ' ' << escape(entry.answers[part]) << '\n';
+        }
+        for (const CachedRun& past : entry.history) {
+            file << "run " << past.when << ' ' << past.mode << ' ' << past.us[0] << ' ' << past.us[1] << '\n';
+            for (const std::string& detail : past.details) file << "detail " << escape(detail) << '\n';
+        }
+        if (!file.flush()) return false;
+    }
+    std::filesystem::rename(temporary, target, error);
+    if (!error) return true;
+    std::filesystem::remove(temporary, error);
+    return false;
+}
+
+} // namespace aoc
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include "harness.hpp"
+
+namespace aoc {
+
+// Content-addressed store of answers and timings under .aoc-cache/, used
+// by `aoc --cache`. An entry is keyed by a hash of the input bytes, the
+// day's build fingerprint (Registry::fingerprint) and the variant, so a hit
+// means the same code already ran on the same input: `aoc` prints the
+// stored answers (and, under --bench, the stored report of the last
+// benchmark in the same mode) instead of running again unless --force is
+// given. Every run appends its times to the entry's history.
+//
+// One text file per entry, .aoc-cache/<year>/day<NN>/<key>:
+//
+//   answer 1 <answer>
+//   answer 2 <answer>
+//   run <unix time> <mode> <part 1 µs> <part 2 µs>
+//   detail <line of the --bench report>
+//   ...
+
+// One recorded run
+struct CachedRun {
+    int64_t when = 0;
+    std::string mode;  // "run", "bench" or "bench-flush"
+    double us[2] = {0, 0};
+    std::vector<std::string> details;  // RunResult::details of a benchmark
+};
+
+struct CacheEntry {
+    std::string answers[2];
+    std::vector<CachedRun> history;  // oldest first
+
+    // Latest run in `mode`, or nullptr
+    const CachedRun* latest(const std::string& mode) const;
+};
+
+class ResultCache {
+public:
+    explicit ResultCache(std::string directory = default_directory());
+
+    // $AOC_CACHE_DIR, or .aoc-cache/ in the source tree
+    static std::string default_directory();
+
+    // "<input hash>-<fingerprint>[-<variant>]"
+    static std::string key(const std::string& input, const char* fingerprint, const std::string& variant);
+
+    std::optional<CacheEntry> load(int year, int day, const std::string& key) const;
+
+    // Store the answers of a complete run and append its times. False if
+    // the entry cannot be written.
+    bool record(int year, int day, const std::string& key, const RunResult& result, const std::string& mode) const;
+
+private:
+    std::string path(int year, int day, const std::string& key) const;
+
+    std::string directory_;
+};
+
+} // namespace aoc
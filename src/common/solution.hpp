@@ -1,9 +1,10 @@
 #pragma once
 
 #include <string>
-#include <chrono>
+#include <vector>
 #include <iostream>
-#include <iomanip>
+#include "answer.hpp"
+#include "metrics.hpp"
 
 namespace aoc {
 
@@ -11,49 +12,40 @@ class Solution {
 public:
     virtual ~Solution() = default;
     
-    virtual std::string part1(const std::string& input) = 0;
-    virtual std::string part2(const std::string& input) = 0;
+    virtual Answer part1(const std::string& input) = 0;
+    virtual Answer part2(const std::string& input) = 0;
     
     virtual int year() const = 0;
     virtual int day() const = 0;
     
-    void run(const std::string& input, bool benchmark = false) {
-        if (benchmark) {
-            run_benchmark(input);
-        } else {
-            std::cout << "Part 1: " << part1(input) << "\n";
-            std::cout << "Part 2: " << part2(input) << "\n";
-        }
-    }
+    // Alternative implementations, selectable with --variant=<name>.
+    // The first entry is the default used when no variant is requested.
+    virtual std::vector<std::string> variants() const { return {}; }
+    virtual bool set_variant(const std::string&) { return false; }
     
-private:
-    void run_benchmark(const std::string& input, int iterations = 100) {
-        using Clock = std::chrono::high_resolution_clock;
-        
-        // Warmup
-        part1(input);
-        part2(input);
-        
-        // Benchmark Part 1
-        auto start = Clock::now();
-        std::string result1;
-        for (int i = 0; i < iterations; ++i) {
-            result1 = part1(input);
+    // Whether a variant answers every input exactly. --verify compares
+    // only exact variants with each other; the rest (fixed-width or
+    // modular counters, say) are checked against known answers alone.
+    virtual bool exact_variant(const std::string&) const { return true; }
+    
+    // Problem size of `input` for --scale, and a copy of `input` cut down
+    // to about `n` of those units. By default a unit is a line and the cut
+    // keeps the first n lines; solutions whose inputs don't survive that
+    // (sections, columns, closed polygons) override both.
+    virtual size_t scale_size(const std::string& input) const {
+        size_t lines = 0;
+        for (size_t pos = 0; pos < input.size(); pos++) {
+            if (input[pos] == '\n' || pos + 1 == input.size()) lines++;
         }
-        auto p1_time = std::chrono::duration_cast<std::chrono::microseconds>(
-            Clock::now() - start).count() / iterations;
-        
-        // Benchmark Part 2
-        start = Clock::now();
-        std::string result2;
-        for (int i = 0; i < iterations; ++i) {
-            result2 = part2(input);
+        return lines;
+    }
+    virtual std::string scale_input(const std::string& input, size_t n) const {
+        size_t pos = 0;
+        for (size_t line = 0; line < n && pos < input.size(); line++) {
+            pos = input.find('\n', pos);
+            pos = pos == std::string::npos ? input.size() : pos + 1;
         }
-        auto p2_time = std::chrono::duration_cast<std::chrono::microseconds>(
-            Clock::now() - start).count() / iterations;
-        
-        std::cout << "Part 1: " << result1 << " (" << p1_time << " µs)\n";
-        std::cout << "Part 2: " << result2 << " (" << p2_time << " µs)\n";
+        return input.substr(0, pos);
     }
 };
 
@@ -0,0 +1,105 @@
+#include "thread_pool.hpp"
+
+namespace aoc {
+
+namespace {
+
+unsigned default_concurrency = 0;
+
+// Which pool (if any) the current thread works for, and its queue
+thread_local ThreadPool* current_pool = nullptr;
+thread_local size_t current_queue = 0;
+
+} // namespace
+
+ThreadPool::ThreadPool(unsigned concurrency) {
+    if (concurrency == 0) concurrency = 1;
+    const size_t workers = concurrency - 1;
+    for (size_t i = 0; i <= workers; i++) queues_.push_back(std::make_unique<Queue>());
+    for (size_t i = 0; i < workers; i++) workers_.emplace_back([this, i] { worker_loop(i); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) worker.join();
+}
+
+ThreadPool& ThreadPool::instance() {
+    static ThreadPool pool(default_concurrency ? default_concurrency
+                                               : std::max(1u, std::thread::hardware_concurrency()));
+    return pool;
+}
+
+void ThreadPool::set_default_concurrency(unsigned concurrency) {
+    default_concurrency = concurrency;
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    const size_t home = current_pool == this ? current_queue : queues_.size() - 1;
+    {
+        std::lock_guard<std::mutex> lock(queues_[home]->mutex);
+        queues_[home]->tasks.push_back(std::move(task));
+    }
+    pending_.fetch_add(1, std::memory_order_release);
+    // Taking the lock orders this against a worker checking pending_ before sleeping
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    wake_.notify_one();
+}
+
+bool ThreadPool::take_task(size_t home, std::function<void()>& task) {
+    if (pending_.load(std::memory_order_acquire) == 0) return false;
+
+    // Own queue first, newest task (still warm in cache)
+    if (home < workers_.size()) {
+        Queue& own = *queues_[home];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    // Then steal the oldest task from everyone else
+    for (size_t k = 1; k <= queues_.size(); k++) {
+        Queue& victim = *queues_[(home + k) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ThreadPool::run_pending_task() {
+    std::function<void()> task;
+    const size_t home = current_pool == this ? current_queue : queues_.size() - 1;
+    if (!take_task(home, task)) return false;
+    task();
+    return true;
+}
+
+void ThreadPool::worker_loop(size_t index) {
+    current_pool = this;
+    current_queue = index;
+    std::function<void()> task;
+    while (true) {
+        if (take_task(index, task)) {
+            task();
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [this] { return stop_ || pending_.load(std::memory_order_acquire) > 0; });
+        if (stop_) return;
+    }
+}
+
+} // namespace aoc
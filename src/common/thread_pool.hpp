@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace aoc {
+
+// Work-stealing thread pool.
+// Every worker owns a deque: it pushes and pops its own tasks at the back
+// and, when empty, steals from the front of the others. Threads outside
+// the pool submit to a shared queue that workers steal from as well. A
+// pool of concurrency N has N - 1 workers, because the thread that waits
+// on a TaskGroup runs tasks too.
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned concurrency);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // The process-wide pool, created on first use
+    static ThreadPool& instance();
+
+    // Concurrency for instance(); 0 means hardware concurrency.
+    // Only has an effect before the first call to instance().
+    static void set_default_concurrency(unsigned concurrency);
+
+    unsigned concurrency() const { return unsigned(workers_.size()) + 1; }
+
+    void submit(std::function<void()> task);
+
+    // Run one queued task on the calling thread; false if there was none
+    bool run_pending_task();
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues_;  // one per worker, then the shared one
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> pending_{0};
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+
+    bool take_task(size_t home, std::function<void()>& task);
+    void worker_loop(size_t index);
+};
+
+// A set of tasks that can be waited on together. wait() runs queued tasks
+// while it waits (so nested groups can't deadlock) and rethrows the first
+// exception a task threw.
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool& pool = ThreadPool::instance()) : pool_(pool) {}
+    ~TaskGroup() { drain(); }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    template <typename F>
+    void run(F fn) {
+        outstanding_.fetch_add(1, std::memory_order_relaxed);
+        pool_.submit([this, fn = std::move(fn)]() mutable {
+            try {
+                fn();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex_);
+                if (!error_) error_ = std::current_exception();
+            }
+            outstanding_.fetch_sub(1, std::memory_order_release);  // last touch of *this
+        });
+    }
+
+    void wait() {
+        drain();
+        if (error_) {
+            std::exception_ptr error = error_;
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    ThreadPool& pool_;
+    std::atomic<size_t> outstanding_{0};
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+
+    void drain() {
+        while (outstanding_.load(std::memory_order_acquire) > 0) {
+            if (!pool_.run_pending_task()) std::this_thread::yield();
+        }
+    }
+};
+
+// Runs fn(state, begin, end) over chunks of `grain` indices from [0, n).
+// Chunks are handed out dynamically to up to concurrency() runners, each
+// with its own copy of `init`; the runners' states are returned (in runner
+// order, which says nothing about which chunks they processed). grain 0
+// picks about eight chunks per thread. The first exception stops the
+// remaining chunks and is rethrown.
+template <typename State, typename F>
+std::vector<State> parallel_for_state(size_t n, size_t grain, const State& init, F fn) {
+    ThreadPool& pool = ThreadPool::instance();
+    if (grain == 0) grain = std::max<size_t>(1, n / (8 * size_t(pool.concurrency())));
+    const size_t chunks = (n + grain - 1) / grain;
+    const size_t runners = std::max<size_t>(1, std::min<size_t>(pool.concurrency(), chunks));
+
+    std::vector<State> states(runners, init);
+    std::atomic<size_t> next{0};
+    auto runner = [&](size_t r) {
+        try {
+            for (size_t c = next++; c < chunks; c = next++) {
+                fn(states[r], c * grain, std::min(n, (c + 1) * grain));
+            }
+        } catch (...) {
+            next = chunks;
+            throw;
+        }
+    };
+
+    TaskGroup group(pool);
+    for (size_t r = 1; r < runners; r++) group.run([&runner, r] { runner(r); });
+    runner(0);
+    group.wait();
+    return states;
+}
+
+// Runs fn(begin, end) over chunks of [0, n), see parallel_for_state
+template <typename F>
+void parallel_for_ranges(size_t n, size_t grain, F fn) {
+    struct None {};
+    parallel_for_state(n, grain, None{}, [&fn](None&, size_t begin, size_t end) { fn(begin, end); });
+}
+
+// Runs fn(i) for every i in [0, n)
+template <typename F>
+void parallel_for(size_t n, F fn, size_t grain = 0) {
+    parallel_for_ranges(n, grain, [&fn](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) fn(i);
+    });
+}
+
+// Deterministic reduction: map(begin, end) is evaluated on fixed chunks of
+// `grain` indices and the partial results are combined left to right, so
+// the result is the same for any thread count or schedule (even for
+// floating point). grain 0 picks at most 256 chunks, independent of the
+// thread count for the same reason.
+template <typename T, typename Map, typename Combine>
+T parallel_reduce(size_t n, size_t grain, T identity, Map map, Combine combine) {
+    if (grain == 0) grain = std::max<size_t>(1, (n + 255) / 256);
+    const size_t chunks = (n + grain - 1) / grain;
+    std::vector<T> partial(chunks, identity);
+    parallel_for_ranges(chunks, 1, [&](size_t first, size_t last) {
+        for (size_t c = first; c < last; c++) partial[c] = map(c * grain, std::min(n, (c + 1) * grain));
+    });
+    T result = identity;
+    for (const T& value : partial) result = combine(result, value);
+    return result;
+}
+
+} // namespace aoc
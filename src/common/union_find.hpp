@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+
+// Disjoint-set forest with union by size and iterative path halving.
+// Tracks the size of every component and the number of components.
+class UnionFind {
+public:
+    explicit UnionFind(int n) : parent_(n), size_(n, 1), components_(n) {
+        for (int i = 0; i < n; i++) parent_[i] = i;
+    }
+
+    int find(int x) {
+        while (parent_[x] != x) {
+            parent_[x] = parent_[parent_[x]];
+            x = parent_[x];
+        }
+        return x;
+    }
+
+    // Returns false if a and b were already connected
+    bool unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+        if (size_[a] < size_[b]) std::swap(a, b);
+        parent_[b] = a;
+        size_[a] += size_[b];
+        components_--;
+        return true;
+    }
+
+    bool same(int a, int b) { return find(a) == find(b); }
+
+    // Size of the component containing x
+    int size(int x) { return size_[find(x)]; }
+
+    int components() const { return components_; }
+    int element_count() const { return parent_.size(); }
+
+    // Sizes of all components, one entry per root
+    std::vector<int> component_sizes() {
+        std::vector<int> sizes;
+        sizes.reserve(components_);
+        for (int i = 0; i < element_count(); i++) {
+            if (parent_[i] == i) sizes.push_back(size_[i]);
+        }
+        return sizes;
+    }
+
+private:
+    std::vector<int> parent_;
+    std::vector<int> size_;
+    int components_;
+};
+
+// Lock-free union-find for merging components from many threads.
+// Parent links are updated with CAS only: roots are linked by index (the
+// larger root always points at the smaller one, so no cycles can form) and
+// find() does path halving with a CAS that is allowed to fail. No thread
+// ever waits on another; a failed CAS just means someone else made
+// progress. Component sizes are only meaningful once all threads are done.
+class ConcurrentUnionFind {
+public:
+    explicit ConcurrentUnionFind(int n) : parent_(n) {
+        for (int i = 0; i < n; i++) parent_[i].store(i, std::memory_order_relaxed);
+    }
+
+    int find(int x) {
+        while (true) {
+            int p = parent_[x].load(std::memory_order_acquire);
+            if (p == x) return x;
+            int gp = parent_[p].load(std::memory_order_acquire);
+            if (gp != p) {
+                parent_[x].compare_exchange_weak(p, gp, std::memory_order_release,
+                                                 std::memory_order_relaxed);
+            }
+            x = gp;
+        }
+    }
+
+    // Returns true for exactly one of any set of racing calls that merge
+    // the same two components
+    bool unite(int a, int b) {
+        while (true) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return false;
+            if (a < b) std::swap(a, b);
+            int expected = a;
+            if (parent_[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel)) {
+                return true;
+            }
+        }
+    }
+
+    bool same(int a, int b) {
+        while (true) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return true;
+            // a was still a root after b was found: disjoint at that point
+            if (parent_[a].load(std::memory_order_acquire) == a) return false;
+        }
+    }
+
+    int element_count() const { return parent_.size(); }
+
+    // Sizes of all components, one entry per root (call when quiescent)
+    std::vector<int> component_sizes() {
+        std::vector<int> count(element_count(), 0);
+        for (int i = 0; i < element_count(); i++) count[find(i)]++;
+        std::vector<int> sizes;
+        for (int c : count) {
+            if (c > 0) sizes.push_back(c);
+        }
+        return sizes;
+    }
+
+private:
+    std::vector<std::atomic<int>> parent_;
+};
+
+} // namespace aoc
@@ -0,0 +1,215 @@
+#include "verify.hpp"
+#include "thread_pool.hpp"
+#include "utils.hpp"
+#include "watchdog.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+
+namespace aoc {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+enum class Status { Skipped, Passed, Unchecked, TimedOut, Failed };
+
+// One part of one variant on one target
+struct Check {
+    size_t target = 0;
+    std::string variant;  // empty: the default implementation
+    int part = 1;
+    std::optional<std::string> expected;
+
+    // Filled in by the check's task
+    Status status = Status::Skipped;
+    std::string answer;
+    std::string message;  // why it failed or was stopped
+    double us = 0;
+};
+
+// First answer of a (target, part) without a known answer; the other
+// variants must match it
+struct Reference {
+    bool set = false;
+    bool disputed = false;  // some variant answered differently
+    std::string answer;
+    std::string variant;
+};
+
+std::string variant_label(const std::string& variant) {
+    return variant.empty() ? "default" : variant;
+}
+
+std::string file_name(const std::string& path) {
+    const size_t slash = path.rfind('/');
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+} // namespace
+
+std::string answers_path(const std::string& input_path) {
+    const size_t slash = input_path.rfind('/');
+    const std::string dir = slash == std::string::npos ? "" : input_path.substr(0, slash + 1);
+    std::string name = input_path.substr(dir.size());
+    if (name == "input.txt") return dir + "answers.txt";
+    if (name.size() > 4 && name.compare(name.size() - 4, 4, ".txt") == 0) name.resize(name.size() - 4);
+    return dir + name + "_answers.txt";
+}
+
+std::optional<KnownAnswers> read_answers(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) return std::nullopt;
+    KnownAnswers answers;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.rfind("Part ", 0) != 0 || line.size() < 8 || line.compare(6, 2, ": ") != 0) continue;
+        if (line[5] == '1' || line[5] == '2') answers.parts[line[5] - '1'] = line.substr(8);
+    }
+    return answers;
+}
+
+int verify(const std::vector<VerifyTarget>& targets, const VerifyOptions& options) {
+    // Inputs are read once and shared by every check on them
+    std::vector<std::string> inputs;
+    std::vector<Check> checks;
+    for (size_t t = 0; t < targets.size(); t++) {
+        const VerifyTarget& target = targets[t];
+        inputs.push_back(read_file(target.input_path));
+        const auto known = read_answers(answers_path(target.input_path));
+
+        const auto solution = target.entry->create();
+        std::vector<std::string> variants;
+        if (!options.variant.empty()) {
+            variants.push_back(options.variant);
+        } else {
+            variants = solution->variants();
+            if (variants.empty()) variants.push_back("");
+        }
+        for (const std::string& variant : variants) {
+            for (int part = 1; part <= target.entry->parts; part++) {
+                Check check;
+                check.target = t;
+                check.variant = variant;
+                check.part = part;
+                if (known) check.expected = known->parts[part - 1];
+                // Without a known answer only exact variants are compared
+                if (!check.expected && options.variant.empty() && !solution->exact_variant(variant)) continue;
+                checks.push_back(check);
+            }
+        }
+    }
+
+    std::vector<Reference> references(targets.size() * 2);
+    std::mutex mutex;
+    std::atomic<bool> failed{false};
+    // The watchdog follows one call at a time, so with a timeout the checks
+    // run one after another
+    const bool watched = part_timeout() > 0;
+    auto run_check = [&](Check& check) {
+        if (failed.load(std::memory_order_relaxed) && !options.keep_going) return;
+        const VerifyTarget& target = targets[check.target];
+        const std::string& input = inputs[check.target];
+        try {
+            auto solution = target.entry->create();
+            if (!check.variant.empty() && !solution->set_variant(check.variant)) {
+                throw std::runtime_error("unknown variant '" + check.variant + "'");
+            }
+            if (watched) begin_call(check.part);
+            const auto start = Clock::now();
+            const Answer answer = check.part == 1 ? solution->part1(input) : solution->part2(input);
+            check.us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+            check.answer = answer.to_string();
+            if (watched) end_call();
+        } catch (const PartCancelled& e) {
+            // Out of time is not a wrong answer: the check is reported and
+            // left out of the comparison
+            end_call();
+            check.status = Status::TimedOut;
+            check.message = e.what();
+            return;
+        } catch (const std::exception& e) {
+            if (watched) end_call();
+            check.status = Status::Failed;
+            check.message = std::string("error: ") + e.what();
+            failed = true;
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (check.expected) {
+            check.status = check.answer == *check.expected ? Status::Passed : Status::Failed;
+            if (check.status == Status::Failed) check.message = "expected " + *check.expected;
+        } else {
+            Reference& reference = references[check.target * 2 + check.part - 1];
+            if (!reference.set) {
+                reference = {true, false, check.answer, check.variant};
+                check.status = Status::Unchecked;
+            } else if (check.answer == reference.answer) {
+                check.status = Status::Unchecked;
+            } else {
+                check.status = Status::Failed;
+                check.message = variant_label(reference.variant) + " answered " + reference.answer;
+                reference.disputed = true;
+            }
+        }
+        if (check.status == Status::Failed) failed = true;
+    };
+    if (watched) {
+        for (Check& check : checks) run_check(check);
+    } else {
+        TaskGroup group;
+        for (Check& check : checks) group.run([&] { run_check(check); });
+        group.wait();
+    }
+
+    // Without a known answer, variants that agree with each other pass;
+    // when they don't, there is no telling which is right, so all fail
+    std::vector<int> answered(references.size(), 0);
+    for (const Check& check : checks) {
+        if (check.status == Status::Unchecked) answered[check.target * 2 + check.part - 1]++;
+    }
+    for (Check& check : checks) {
+        if (check.status != Status::Unchecked) continue;
+        const size_t group = check.target * 2 + check.part - 1;
+        if (references[group].disputed) {
+            check.status = Status::Failed;
+            check.message = "variants disagree";
+        } else if (answered[group] > 1) {
+            check.status = Status::Passed;
+        }
+    }
+
+    int counts[5] = {0, 0, 0, 0, 0};
+    for (const Check& check : checks) {
+        counts[int(check.status)]++;
+        if (check.status == Status::Skipped) continue;
+        const VerifyTarget& target = targets[check.target];
+        const char* label = check.status == Status::Passed     ? "ok"
+                            : check.status == Status::Failed   ? "FAIL"
+                            : check.status == Status::TimedOut ? "TIME"
+                                                               : "?";
+        std::printf("%-5s %d Day %02d  %-16s part %d  %-12s %s", label, target.entry->year, target.entry->day,
+                    file_name(target.input_path).c_str(), check.part, variant_label(check.variant).c_str(),
+                    check.answer.c_str());
+        if (!check.message.empty()) std::printf(" (%s)", check.message.c_str());
+        else if (check.status == Status::Unchecked) std::printf(" (no known answer)");
+        else std::printf(" (%.0f µs)", check.us);
+        std::printf("\n");
+    }
+    std::printf("%zu checks: %d passed, %d failed, %d without a known answer", checks.size(),
+                counts[int(Status::Passed)], counts[int(Status::Failed)], counts[int(Status::Unchecked)]);
+    if (counts[int(Status::TimedOut)]) std::printf(", %d timed out", counts[int(Status::TimedOut)]);
+    if (counts[int(Status::Skipped)]) {
+        std::printf(", %d skipped after the first failure (--keep-going runs them)", counts[int(Status::Skipped)]);
+    }
+    std::printf("\n");
+    std::fflush(stdout);
+    return counts[int(Status::Failed)];
+}
+
+} // namespace aoc
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+#include "registry.hpp"
+
+namespace aoc {
+
+// Known answers of an input, as the "Part 1: <answer>" lines `aoc` prints
+// (other lines are ignored): answers.txt next to input.txt, and
+// <name>_answers.txt for any other <name>.txt, e.g. example_answers.txt
+std::string answers_path(const std::string& input_path);
+
+// Expected answer of each part, where the file has one
+struct KnownAnswers {
+    std::optional<std::string> parts[2];
+};
+
+// Nothing if there is no answers file
+std::optional<KnownAnswers> read_answers(const std::string& path);
+
+// One input to check a solution on
+struct VerifyTarget {
+    const SolutionEntry* entry;
+    std::string input_path;
+};
+
+// How `aoc --verify` runs
+struct VerifyOptions {
+    std::string variant;      // check only this variant; empty checks every one
+    bool keep_going = false;  // don't stop at the first failure
+};
+
+// Run every part of every variant (or the default implementation, for
+// solutions without variants) on every target, each as its own task on
+// the thread pool. Answers are compared with the known answers, and where
+// there are none, with each other, so generated inputs still get a
+// differential check between variants; variants that are not
+// exact_variant() sit that comparison out. Prints one line per check in
+// target order and returns the number of failed checks. Unless
+// keep_going is set, checks that haven't started yet are skipped once one
+// fails. With a part timeout set, the checks run one at a time under the
+// watchdog; a check that runs out of time is reported, but neither fails
+// nor takes part in the comparison.
+int verify(const std::vector<VerifyTarget>& targets, const VerifyOptions& options);
+
+} // namespace aoc
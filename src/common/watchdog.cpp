@@ -0,0 +1,151 @@
+#include "watchdog.hpp"
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace aoc {
+
+namespace {
+
+std::atomic<int64_t> timeout_ns{0};
+std::atomic<pid_t> watchdog_pid{0};
+
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void watchdog_loop() {
+    CallStatus& status = call_status();
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        const int64_t limit = timeout_ns.load();
+        const uint64_t call = status.call.load();
+        const int64_t started = status.started_ns.load();
+        if (limit == 0 || started == 0) continue;
+
+        const int64_t elapsed = now_ns() - started;
+        if (elapsed > limit) status.cancelled.store(call);
+        if (elapsed > limit + int64_t(GRACE_SECONDS * 1e9) && status.call.load() == call &&
+            status.started_ns.load() != 0) {
+            std::fflush(stdout);
+            std::fprintf(stderr, "Part %d did not stop within %.1f s of its %.1f s timeout (%s); exiting\n",
+                         status.part.load(), GRACE_SECONDS, limit / 1e9, progress_text().c_str());
+            std::_Exit(124);
+        }
+    }
+}
+
+// One watchdog thread per process (threads don't survive fork())
+void ensure_watchdog() {
+    const pid_t pid = getpid();
+    if (watchdog_pid.exchange(pid) != pid) std::thread(watchdog_loop).detach();
+}
+
+} // namespace
+
+CallStatus& call_status() {
+    static CallStatus* status = [] {
+        void* memory = mmap(nullptr, sizeof(CallStatus), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        return memory == MAP_FAILED ? new CallStatus : new (memory) CallStatus;
+    }();
+    return *status;
+}
+
+void set_part_timeout(double seconds) {
+    timeout_ns.store(int64_t(seconds * 1e9));
+}
+
+double part_timeout() {
+    return timeout_ns.load() / 1e9;
+}
+
+void begin_call(int part) {
+    CallStatus& status = call_status();
+    status.part.store(part);
+    status.done.store(0);
+    status.total.store(0);
+    status.call.fetch_add(1);
+    status.started_ns.store(now_ns());
+    if (timeout_ns.load() > 0) ensure_watchdog();
+}
+
+void end_call() {
+    call_status().started_ns.store(0);
+}
+
+double call_elapsed() {
+    const int64_t started = call_status().started_ns.load();
+    return started ? (now_ns() - started) / 1e9 : 0;
+}
+
+void throw_cancelled() {
+    char what[160];
+    std::snprintf(what, sizeof(what), "timed out after %.1f s, %s", call_elapsed(), progress_text().c_str());
+    throw PartCancelled(what);
+}
+
+std::string progress_text() {
+    const CallStatus& status = call_status();
+    const uint64_t done = status.done.load(), total = status.total.load();
+    char buf[96];
+    if (total > 0) {
+        std::snprintf(buf, sizeof(buf), "progress %llu/%llu (%.1f%%)", (unsigned long long)done,
+                      (unsigned long long)total, 100.0 * done / total);
+    } else if (done > 0) {
+        std::snprintf(buf, sizeof(buf), "progress %llu", (unsigned long long)done);
+    } else {
+        return "no progress reported";
+    }
+    return buf;
+}
+
+int run_supervised(const std::function<int()>& body) {
+    CallStatus& status = call_status();  // map the shared page before forking
+    std::cout.flush();
+    std::fflush(stdout);
+    std::fflush(stderr);
+
+    const pid_t child = fork();
+    if (child < 0) return body();  // no fork: run unsupervised
+    if (child == 0) {
+        int code = 1;
+        try {
+            code = body();
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+        }
+        std::cout.flush();
+        std::fflush(stdout);
+        std::_Exit(code);
+    }
+
+    while (true) {
+        int wait_status = 0;
+        if (waitpid(child, &wait_status, WNOHANG) == child) {
+            if (WIFEXITED(wait_status)) return WEXITSTATUS(wait_status);
+            std::cerr << "Child process died with signal " << WTERMSIG(wait_status) << "\n";
+            return 128 + WTERMSIG(wait_status);
+        }
+        const int64_t limit = timeout_ns.load();
+        const int64_t started = status.started_ns.load();
+        if (limit > 0 && started != 0 && now_ns() - started > limit + int64_t(2 * GRACE_SECONDS * 1e9)) {
+            kill(child, SIGKILL);
+            waitpid(child, &wait_status, 0);
+            std::fflush(stdout);
+            std::fprintf(stderr, "Part %d killed after %.1f s (%s)\n", status.part.load(),
+                         (now_ns() - started) / 1e9, progress_text().c_str());
+            return 124;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+}
+
+} // namespace aoc
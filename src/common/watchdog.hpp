@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+namespace aoc {
+
+// Per-call time limits for solution parts.
+//
+// The harness brackets every part call with begin_call()/end_call(). A
+// watchdog thread cancels a call that runs past the timeout; the part
+// notices at its next checkpoint() and unwinds with PartCancelled, so the
+// harness can report how far it got and move on. Long-running loops call
+// checkpoint() (or progress_advance(), which also records progress) often
+// enough to stop within a fraction of a second.
+//
+// A call that does not reach a checkpoint within GRACE_SECONDS of being
+// cancelled is stopped the hard way: run_supervised() runs solutions in a
+// forked child that the parent kills, and without a parent the process
+// exits with status 124.
+
+constexpr double GRACE_SECONDS = 1.0;
+
+// what() reads "timed out after 2.0 s, progress 37/200 (18.5%)"
+class PartCancelled : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// State of the current call. Lives in memory shared with a supervising
+// parent process, which reads it to report where a killed child was.
+struct CallStatus {
+    std::atomic<uint64_t> call{0};          // sequence number of the current call
+    std::atomic<uint64_t> cancelled{0};     // sequence number of the cancelled call
+    std::atomic<int> part{0};
+    std::atomic<int64_t> started_ns{0};     // steady clock; 0 between calls
+    std::atomic<uint64_t> done{0};
+    std::atomic<uint64_t> total{0};
+};
+
+CallStatus& call_status();
+
+// Time limit for every part call in seconds; 0 (the default) disables the
+// watchdog
+void set_part_timeout(double seconds);
+double part_timeout();
+
+void begin_call(int part);
+void end_call();
+
+// Seconds since the current call began
+double call_elapsed();
+
+[[noreturn]] void throw_cancelled();
+
+// Throws PartCancelled if the watchdog has cancelled the current call
+inline void checkpoint() {
+    CallStatus& status = call_status();
+    if (status.cancelled.load(std::memory_order_relaxed) == status.call.load(std::memory_order_relaxed) &&
+        status.started_ns.load(std::memory_order_relaxed) != 0) {
+        throw_cancelled();
+    }
+}
+
+// Progress of the current call, reported on timeout as done/total
+inline void progress_total(uint64_t total) {
+    call_status().total.store(total, std::memory_order_relaxed);
+}
+
+inline void progress_advance(uint64_t n = 1) {
+    call_status().done.fetch_add(n, std::memory_order_relaxed);
+    checkpoint();
+}
+
+// "progress 37/200 (18.5%)", or "no progress reported"
+std::string progress_text();
+
+// Run `body` in a forked child and return its exit status. The parent
+// SIGKILLs the child when a part call overruns its timeout by more than
+// twice the grace period, prints the part's progress, and returns 124.
+// Standard output is flushed before the fork.
+int run_supervised(const std::function<int()>& body);
+
+} // namespace aoc
@@ -1,17 +1,196 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <cstring>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <vector>
+#include "common/cpu_dispatch.hpp"
+#include "common/harness.hpp"
+#include "common/memory.hpp"
 #include "common/solution.hpp"
+#include "common/thread_pool.hpp"
 #include "common/registry.hpp"
+#include "common/result_cache.hpp"
 #include "common/utils.hpp"
+#include "common/verify.hpp"
+#include "common/watchdog.hpp"
 
 void print_usage(const char* prog) {
     std::cerr << "Usage: " << prog << " <year> <day> [options]\n"
+              << "       " << prog << " --all [options]\n"
+              << "       " << prog << " --verify [options]\n"
               << "       " << prog << " --list\n\n"
               << "Options:\n"
-              << "  --bench    Run with benchmarking\n"
-              << "  --example  Use example input instead of puzzle input\n"
-              << "  --list     List all available solutions\n";
+              << "  --bench           Run with benchmarking (cold start, then warm iterations)\n"
+              << "  --flush           With --bench, evict the CPU caches before every timed call\n"
+              << "  --pin=<cpus>      Pin the process to CPUs, e.g. 3 or 2-5 (threads default to their count)\n"
+              << "  --scale           Time both parts on inputs cut to n, n/2, n/4, ... and fit n^k\n"
+              << "  --scale-steps=<k> Number of input sizes for --scale (default: 8)\n"
+              << "  --csv=<path>      With --scale, also write the measurements as CSV\n"
+              << "  --mem-limit=<sz>  Fail a part that holds more heap than this, e.g. 512M or 4G\n"
+              << "  --timeout=<s>     Stop a part call that runs longer than this many seconds (with --verify,\n"
+              << "                    checks then run one at a time)\n"
+              << "  --cache           Reuse and record answers and timings in .aoc-cache/ (not with --isa,\n"
+              << "                    --threads or --pin)\n"
+              << "  --force           With --cache, run even if the cache has this build's answers\n"
+              << "  --example         Use example input instead of puzzle input\n"
+              << "  --input=<path>    Use the given input file\n"
+              << "  --variant=<name>  Select an alternative implementation ('all' runs each)\n"
+              << "  --variants        List the variants of a solution\n"
+              << "  --threads=<n>     Worker threads for parallel solutions (default: all cores)\n"
+              << "  --isa=<name>      Cap SIMD kernels at scalar, sse4.2, avx2 or avx512\n"
+              << "  --list            List all available solutions\n"
+              << "  --all             Run every solution on its input (days without one are skipped)\n"
+              << "  --verify          Check every part of every variant against the known answers\n"
+              << "                    (answers.txt, example_answers.txt), or each other where there are none\n"
+              << "  --keep-going      With --verify, run every check instead of stopping at the first failure\n";
+}
+
+std::string default_input_path(int year, int day, bool use_example) {
+    std::string input_file = aoc::input_path(year, day);
+    if (use_example) {
+        // Replace input.txt with example.txt
+        auto pos = input_file.rfind("input.txt");
+        if (pos != std::string::npos) {
+            input_file.replace(pos, 9, "example.txt");
+        }
+    }
+    return input_file;
+}
+
+// How run_solution runs each solution
+struct RunOptions {
+    const aoc::BenchOptions* benchmark = nullptr;
+    const aoc::ScaleOptions* scale = nullptr;
+    bool cache = false;  // go through the result cache
+    bool force = false;  // run even when the result cache has the answers
+};
+
+// Print a cache hit the way the run would have printed it
+void print_cached(const aoc::CacheEntry& entry, const aoc::CachedRun* timing) {
+    for (int part = 0; part < 2; part++) {
+        std::cout << "Part " << part + 1 << ": " << entry.answers[part];
+        if (timing) std::cout << " (" << int64_t(timing->us[part]) << " µs)";
+        std::cout << "\n";
+    }
+    if (timing) {
+        for (const std::string& line : timing->details) std::cout << line << "\n";
+    }
+    const aoc::CachedRun& last = entry.history.empty() ? aoc::CachedRun{} : entry.history.back();
+    char when[32] = "?";
+    const std::time_t time = std::time_t(last.when);
+    if (last.when) std::strftime(when, sizeof(when), "%Y-%m-%d %H:%M", std::localtime(&time));
+    std::cout << "  cached result (" << entry.history.size() << " runs recorded, last " << when
+              << "); --force reruns\n";
+}
+
+// Inputs `aoc --verify` checks a solution on: its example, any other
+// <name>.txt next to it that has a <name>_answers.txt (hand-made edge
+// cases), and its puzzle input, those that exist (only the example with
+// --example)
+std::vector<aoc::VerifyTarget> verify_targets(const aoc::SolutionEntry& entry, bool example_only) {
+    std::vector<aoc::VerifyTarget> targets;
+    const std::string example = default_input_path(entry.year, entry.day, true);
+    const std::string input = default_input_path(entry.year, entry.day, false);
+    if (std::ifstream(example)) targets.push_back({&entry, example});
+    if (example_only) return targets;
+    
+    std::vector<std::string> extra;
+    std::error_code error;
+    for (const auto& file : std::filesystem::directory_iterator(std::filesystem::path(input).parent_path(), error)) {
+        const std::string path = file.path().string();
+        const std::string name = file.path().filename().string();
+        if (path == example || path == input || file.path().extension() != ".txt") continue;
+        if (name.size() > 12 && name.compare(name.size() - 12, 12, "_answers.txt") == 0) continue;
+        if (std::ifstream(aoc::answers_path(path))) extra.push_back(path);
+    }
+    std::sort(extra.begin(), extra.end());
+    for (const std::string& path : extra) targets.push_back({&entry, path});
+    if (std::ifstream(input)) targets.push_back({&entry, input});
+    return targets;
+}
+
+// Run one solution on `input_file`, either as is or once per selected
+// variant ("all" selects every variant), plainly or under the benchmark or
+// scaling harness. With options.cache, plain and benchmark runs go through
+// the result cache: a run of unchanged code on an unchanged input prints
+// the stored answers (and, under --bench, the stored report) unless
+// options.force is set, and every run records its answers and times.
+// Returns the process exit code: 124 if a part timed out.
+int run_solution(const aoc::SolutionEntry& entry, aoc::Solution& solution, const std::string& input_file,
+                 const std::string& variant, const RunOptions& options) {
+    const int year = entry.year, day = entry.day;
+    std::vector<std::string> selected;
+    if (variant == "all") {
+        selected = solution.variants();
+    } else if (!variant.empty()) {
+        selected.push_back(variant);
+    }
+    
+    const aoc::BenchOptions* benchmark = options.benchmark;
+    const std::string mode = !benchmark ? "run" : benchmark->flush_caches ? "bench-flush" : "bench";
+    const aoc::ResultCache cache;
+    
+    try {
+        std::string input = aoc::read_file(input_file);
+        std::cout << "=== " << year << " Day " << day << " ===\n";
+        bool finished = true;
+        auto run = [&](const std::string& name) {
+            if (options.scale) {
+                aoc::run_scaling(solution, input, *options.scale);
+                return;
+            }
+            if (!options.cache) {
+                const aoc::RunResult result = benchmark ? aoc::run_benchmark(solution, input, *benchmark)
+                                                        : aoc::run_parts(solution, input);
+                if (!result.complete) finished = false;
+                return;
+            }
+            const std::string key = aoc::ResultCache::key(input, aoc::Registry::fingerprint(entry), name);
+            const auto cached = cache.load(year, day, key);
+            const aoc::CachedRun* timing = cached && benchmark ? cached->latest(mode) : nullptr;
+            if (cached && !options.force && (!benchmark || timing)) {
+                print_cached(*cached, timing);
+                return;
+            }
+            
+            const aoc::RunResult result = benchmark ? aoc::run_benchmark(solution, input, *benchmark)
+                                                    : aoc::run_parts(solution, input);
+            if (!result.complete) {
+                finished = false;
+                return;
+            }
+            // Same code, same input: a different answer means nondeterminism
+            for (int part = 0; cached && part < 2; part++) {
+                if (cached->answers[part] != result.answers[part]) {
+                    std::cerr << "Warning: part " << part + 1 << " answer changed from " << cached->answers[part]
+                              << " (cached) to " << result.answers[part] << "\n";
+                }
+            }
+            if (!cache.record(year, day, key, result, mode)) {
+                std::cerr << "Warning: cannot write the result cache in " << aoc::ResultCache::default_directory()
+                          << "\n";
+            }
+        };
+        if (selected.empty()) run("");
+        for (const auto& name : selected) {
+            if (!solution.set_variant(name)) {
+                std::cerr << "Unknown variant '" << name << "' (see --variants)\n";
+                return 1;
+            }
+            std::cout << "--- " << name << " ---\n";
+            run(name);
+        }
+        if (!finished) return 124;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
 }
 
 int main(int argc, char* argv[]) {
@@ -23,51 +202,201 @@ int main(int argc, char* argv[]) {
     // Handle --list
     if (std::strcmp(argv[1], "--list") == 0) {
         std::cout << "Available solutions:\n";
-        for (auto [year, day] : aoc::Registry::instance().list()) {
-            std::cout << "  " << year << " Day " << day << "\n";
+        for (const aoc::SolutionEntry& entry : aoc::solutions()) {
+            std::cout << "  " << entry.year << " Day " << entry.day << "\n";
         }
         return 0;
     }
     
-    if (argc < 3) {
+    const bool run_all = std::strcmp(argv[1], "--all") == 0;
+    const bool verify_all = std::strcmp(argv[1], "--verify") == 0;
+    if (!run_all && !verify_all && argc < 3) {
         print_usage(argv[0]);
         return 1;
     }
     
-    int year = std::stoi(argv[1]);
-    int day = std::stoi(argv[2]);
-    
     bool benchmark = false;
+    aoc::BenchOptions bench_options;
+    RunOptions run_options;
+    bool verifying = verify_all;
+    aoc::VerifyOptions verify_options;
+    bool scaling = false;
+    aoc::ScaleOptions scale_options;
+    bool threads_set = false;
+    bool isa_set = false;
+    std::vector<int> pin_cpus;
     bool use_example = false;
+    bool list_variants = false;
+    std::string input_override;
+    std::string variant;
+    double timeout = 0;
     
-    for (int i = 3; i < argc; ++i) {
+    for (int i = run_all || verify_all ? 2 : 3; i < argc; ++i) {
         if (std::strcmp(argv[i], "--bench") == 0) benchmark = true;
+        if (std::strcmp(argv[i], "--flush") == 0) bench_options.flush_caches = true;
+        if (std::strcmp(argv[i], "--scale") == 0) scaling = true;
+        if (std::strcmp(argv[i], "--cache") == 0) run_options.cache = true;
+        if (std::strcmp(argv[i], "--force") == 0) run_options.force = true;
+        if (std::strcmp(argv[i], "--verify") == 0) verifying = true;
+        if (std::strcmp(argv[i], "--keep-going") == 0) verify_options.keep_going = true;
+        if (std::strncmp(argv[i], "--csv=", 6) == 0) scale_options.csv_path = argv[i] + 6;
+        if (std::strncmp(argv[i], "--scale-steps=", 14) == 0) {
+            scale_options.steps = std::atoi(argv[i] + 14);
+            if (scale_options.steps < 1) {
+                std::cerr << "--scale-steps expects a positive number\n";
+                return 1;
+            }
+        }
         if (std::strcmp(argv[i], "--example") == 0) use_example = true;
+        if (std::strcmp(argv[i], "--variants") == 0) list_variants = true;
+        if (std::strncmp(argv[i], "--input=", 8) == 0) input_override = argv[i] + 8;
+        if (std::strncmp(argv[i], "--variant=", 10) == 0) variant = argv[i] + 10;
+        if (std::strncmp(argv[i], "--threads=", 10) == 0) {
+            int threads = std::atoi(argv[i] + 10);
+            if (threads < 1) {
+                std::cerr << "--threads expects a positive number\n";
+                return 1;
+            }
+            aoc::ThreadPool::set_default_concurrency(threads);
+            threads_set = true;
+        }
+        if (std::strncmp(argv[i], "--mem-limit=", 12) == 0) {
+            auto limit = aoc::parse_byte_size(argv[i] + 12);
+            if (!limit || *limit == 0) {
+                std::cerr << "--mem-limit expects a size such as 512M or 4G\n";
+                return 1;
+            }
+            aoc::set_memory_limit(*limit);
+        }
+        if (std::strncmp(argv[i], "--timeout=", 10) == 0) {
+            timeout = std::atof(argv[i] + 10);
+            if (timeout <= 0) {
+                std::cerr << "--timeout expects a positive number of seconds\n";
+                return 1;
+            }
+            aoc::set_part_timeout(timeout);
+        }
+        if (std::strncmp(argv[i], "--pin=", 6) == 0) {
+            auto cpus = aoc::parse_cpu_list(argv[i] + 6);
+            if (!cpus) {
+                std::cerr << "--pin expects a CPU list such as 3, 2-5 or 0,2\n";
+                return 1;
+            }
+            pin_cpus = *cpus;
+        }
+        if (std::strncmp(argv[i], "--isa=", 6) == 0) {
+            auto isa = aoc::parse_isa(argv[i] + 6);
+            if (!isa) {
+                std::cerr << "Unknown instruction set '" << (argv[i] + 6) << "'\n";
+                return 1;
+            }
+            try {
+                aoc::set_isa_override(*isa);
+                isa_set = true;
+            } catch (const std::exception& e) {
+                std::cerr << "Error: " << e.what() << "\n";
+                return 1;
+            }
+        }
     }
     
-    auto solution = aoc::Registry::instance().get(year, day);
-    if (!solution) {
-        std::cerr << "No solution found for " << year << " Day " << day << "\n";
+    if (!pin_cpus.empty()) {
+        try {
+            aoc::pin_process(pin_cpus);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
+        }
+        // One worker per pinned CPU rather than per core in the machine
+        if (!threads_set) aoc::ThreadPool::set_default_concurrency(unsigned(pin_cpus.size()));
+    }
+    if (verifying && (benchmark || scaling)) {
+        std::cerr << "--verify runs checks in parallel, without --bench or --scale\n";
         return 1;
     }
     
-    std::string input_file = aoc::input_path(year, day);
-    if (use_example) {
-        // Replace input.txt with example.txt
-        auto pos = input_file.rfind("input.txt");
-        if (pos != std::string::npos) {
-            input_file.replace(pos, 9, "example.txt");
+    // With a timeout, every solution runs in a child process that can be
+    // killed if a part ignores the watchdog
+    auto supervise = [&](const std::function<int()>& body) {
+        return timeout > 0 ? aoc::run_supervised(body) : body();
+    };
+    
+    if (variant != "all") verify_options.variant = variant;
+    auto run_verify = [&](const std::vector<aoc::VerifyTarget>& targets) {
+        return supervise([&] {
+            try {
+                return aoc::verify(targets, verify_options) == 0 ? 0 : 1;
+            } catch (const std::exception& e) {
+                std::cerr << "Error: " << e.what() << "\n";
+                return 1;
+            }
+        });
+    };
+    if (verify_all) {
+        std::vector<aoc::VerifyTarget> targets;
+        for (const aoc::SolutionEntry& entry : aoc::solutions()) {
+            for (const aoc::VerifyTarget& target : verify_targets(entry, use_example)) targets.push_back(target);
         }
+        return run_verify(targets);
     }
+    // The cache key covers the code, input and variant, not these, and
+    // they change what a run measures
+    if (run_options.cache && (isa_set || threads_set || !pin_cpus.empty())) {
+        std::cerr << "Warning: --cache is ignored with --isa, --threads or --pin\n";
+        run_options.cache = false;
+    }
+    if (benchmark) aoc::warn_noisy_environment();
+    run_options.benchmark = benchmark ? &bench_options : nullptr;
+    run_options.scale = scaling ? &scale_options : nullptr;
     
-    try {
-        std::string input = aoc::read_file(input_file);
-        std::cout << "=== " << year << " Day " << day << " ===\n";
-        solution->run(input, benchmark);
-    } catch (const std::exception& e) {
-        std::cerr << "Error: " << e.what() << "\n";
+    if (run_all) {
+        if (scaling) {
+            std::cerr << "--scale runs one solution at a time\n";
+            return 1;
+        }
+        if (!input_override.empty() || (!variant.empty() && variant != "all")) {
+            std::cerr << "--all only combines with --variant=all, not a single input or variant\n";
+            return 1;
+        }
+        int status = 0;
+        for (const aoc::SolutionEntry& entry : aoc::solutions()) {
+            const int year = entry.year, day = entry.day;
+            std::string input_file = default_input_path(year, day, use_example);
+            if (!std::ifstream(input_file)) {
+                std::cerr << "Skipping " << year << " Day " << day << ": no " << input_file << "\n";
+                continue;
+            }
+            auto solution = entry.create();
+            auto body = [&] { return run_solution(entry, *solution, input_file, variant, run_options); };
+            if (supervise(body) != 0) status = 1;
+        }
+        return status;
+    }
+    
+    int year = std::stoi(argv[1]);
+    int day = std::stoi(argv[2]);
+    
+    const aoc::SolutionEntry* entry = aoc::Registry::find(year, day);
+    if (!entry) {
+        std::cerr << "No solution found for " << year << " Day " << day << "\n";
         return 1;
     }
+    auto solution = entry->create();
     
-    return 0;
+    if (list_variants) {
+        std::cout << year << " Day " << day << " variants:\n";
+        for (const auto& name : solution->variants()) {
+            std::cout << "  " << name << "\n";
+        }
+        return 0;
+    }
+    
+    if (verifying) {
+        return run_verify(input_override.empty() ? verify_targets(*entry, use_example)
+                                                 : std::vector<aoc::VerifyTarget>{{entry, input_override}});
+    }
+    
+    std::string input_file = input_override.empty() ? default_input_path(year, day, use_example)
+                                                     : input_override;
+    return supervise([&] { return run_solution(*entry, *solution, input_file, variant, run_options); });
 }